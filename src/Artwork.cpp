@@ -0,0 +1,87 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Artwork: the packed images of the crash modes, attached to the add-on
+ * as 'PKIM' resources (see "packimage -b" and the Makefile) instead of
+ * being compiled in.  The add-on file is only mapped when a mode first
+ * asks for an image, and the data of an image is only paged in when it
+ * is decoded, so the artwork of the other modes never is.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Debug.h>
+
+#include "Artwork.h"
+
+Artwork::Artwork()
+{
+	m_path = NULL;
+	m_opened = false;
+}
+
+Artwork::~Artwork()
+{
+	Unset();
+}
+
+void Artwork::SetTo(const char *path)
+{
+	Unset();
+	m_path = strdup(path);
+}
+
+void Artwork::Unset()
+{
+	for (int32 i = 0; i < m_images.CountItems(); i++)
+	{
+		entry *e = (entry *) m_images.ItemAt(i);
+		free(e->name);
+		delete e;
+	}
+	m_images.MakeEmpty();
+
+	m_file.Unset();
+	m_opened = false;
+	free(m_path);
+	m_path = NULL;
+}
+
+const packed_image *Artwork::Find(const char *name)
+{
+	for (int32 i = 0; i < m_images.CountItems(); i++)
+	{
+		entry *e = (entry *) m_images.ItemAt(i);
+		if (strcmp(e->name, name) == 0)
+			return &e->image;
+	}
+
+	// a file without resources is only tried once
+	if (!m_opened && m_path)
+	{
+		m_opened = true;
+		if (!m_file.SetTo(m_path))
+			PRINT(("BSOD: no artwork resources in %s\n", m_path));
+	}
+	if (!m_file.IsValid())
+		return NULL;
+
+	size_t size;
+	const void *data = m_file.Find(kPackedImageType, name, &size);
+	if (!data)
+		return NULL;
+
+	entry *e = new entry;
+	e->name = NULL;
+	if (!packed_image_from_blob(data, size, &e->image))
+	{
+		PRINT(("BSOD: artwork \"%s\" is damaged\n", name));
+		delete e;
+		return NULL;
+	}
+
+	e->name = strdup(name);
+	m_images.AddItem(e);
+	return &e->image;
+}
@@ -0,0 +1,48 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Artwork: the packed images of the crash modes, attached to the add-on
+ * as 'PKIM' resources (see "packimage -b" and the Makefile) instead of
+ * being compiled in.  The add-on file is only mapped when a mode first
+ * asks for an image, and the data of an image is only paged in when it
+ * is decoded, so the artwork of the other modes never is.
+ */
+
+#ifndef ARTWORK_H
+#define ARTWORK_H
+
+#include <List.h>
+#include <SupportDefs.h>
+
+#include "PackedImage.h"
+#include "ResourceFile.h"
+
+// the resource type of a packed_image_blob
+const type_code kPackedImageType = 'PKIM';
+
+class Artwork {
+ public:
+	Artwork();
+	~Artwork();
+
+	// the file the resources are read from, once they are needed
+	void SetTo(const char *path);
+	void Unset();
+
+	// The image stored under 'name', NULL if there is none; valid until
+	// Unset().
+	const packed_image *Find(const char *name);
+
+ private:
+	struct entry {
+		char *name;
+		packed_image image;
+	};
+
+	char *m_path;
+	bool m_opened;
+	ResourceFile m_file;
+	BList m_images;
+};
+
+#endif // ARTWORK_H
@@ -0,0 +1,193 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Decodes the artwork blobs the add-on carries and compares every pixel
+ * with the images in artwork/ they were made from, taken the way
+ * packimage takes them: the samples of a PGM as B_CMAP8 indices, the
+ * bits of a PBM as B_CMAP8 black and white.  The checksum stored in each
+ * blob is checked too, which debug builds of the add-on rely on.
+ *
+ * Build and run with "make ArtworkCheck && ./ArtworkCheck"; it exits
+ * with 1 on the first image that does not decode to its artwork.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Bitmap.h>
+
+#include "PackedImage.h"
+
+// the B_CMAP8 indices of black and white, as packimage writes them
+static const uint8 kBlack = 0x00;
+static const uint8 kWhite = 0x3f;
+
+static const struct {
+	const char *blob;
+	const char *artwork;
+} kImages[] = {
+	{ "amiga_hand.pkim", "artwork/amiga_hand.pgm" },
+	{ "atari.pkim", "artwork/atari.pbm" },
+	{ "mac.pkim", "artwork/mac.pgm" }
+};
+
+// the whole file in a buffer to free(), NULL if it cannot be read
+static uint8 *read_file(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	if (!file)
+		return NULL;
+
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8 *data = length > 0 ? (uint8 *) malloc(length) : NULL;
+	if (data && fread(data, 1, length, file) != (size_t) length)
+	{
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+
+	*size = length;
+	return data;
+}
+
+// netpbm header fields: whitespace and comments in between; -1 if there
+// is none
+static int pnm_number(const uint8 *data, size_t size, size_t *pos)
+{
+	while (*pos < size)
+	{
+		if (data[*pos] == '#')
+		{
+			while (*pos < size && data[*pos] != '\n')
+				(*pos)++;
+		}
+		else if (isspace(data[*pos]))
+			(*pos)++;
+		else
+			break;
+	}
+
+	if (*pos >= size || !isdigit(data[*pos]))
+		return -1;
+
+	int value = 0;
+	while (*pos < size && isdigit(data[*pos]))
+		value = value * 10 + data[(*pos)++] - '0';
+	return value;
+}
+
+// The pixels of a binary PBM (P4) or 8 bit PGM (P5) as B_CMAP8 indices,
+// width * height of them in a buffer to free(); NULL if it is neither.
+static uint8 *read_pnm(const uint8 *data, size_t size, int *width,
+					   int *height)
+{
+	if (size < 2 || data[0] != 'P' || (data[1] != '4' && data[1] != '5'))
+		return NULL;
+
+	bool bitmap = data[1] == '4';
+	size_t pos = 2;
+	*width = pnm_number(data, size, &pos);
+	*height = pnm_number(data, size, &pos);
+	if (!bitmap && pnm_number(data, size, &pos) != 255)
+		return NULL;
+	pos++;	// the single whitespace ending the header
+
+	if (*width <= 0 || *height <= 0)
+		return NULL;
+
+	size_t row_bytes = bitmap ? (*width + 7) / 8 : *width;
+	if (pos + row_bytes * *height > size)
+		return NULL;
+
+	uint8 *pixels = (uint8 *) malloc((size_t) *width * *height);
+	if (!pixels)
+		return NULL;
+
+	for (int y = 0; y < *height; y++)
+	{
+		const uint8 *row = data + pos + y * row_bytes;
+		for (int x = 0; x < *width; x++)
+		{
+			uint8 value = bitmap
+				? ((row[x / 8] >> (7 - x % 8)) & 1 ? kBlack : kWhite)
+				: row[x];
+			pixels[y * *width + x] = value;
+		}
+	}
+	return pixels;
+}
+
+// whether the blob decodes to the pixels of the artwork, saying why not
+static bool check_image(const char *blob_path, const char *artwork_path)
+{
+	size_t blob_size, artwork_size;
+	uint8 *blob = read_file(blob_path, &blob_size);
+	uint8 *artwork = read_file(artwork_path, &artwork_size);
+	bool ok = false;
+
+	packed_image image;
+	int width = 0, height = 0;
+	uint8 *expected = artwork
+		? read_pnm(artwork, artwork_size, &width, &height) : NULL;
+	BBitmap *bitmap = NULL;
+
+	if (!blob)
+		fprintf(stderr, "%s: cannot be read, see \"make artwork\"\n",
+				blob_path);
+	else if (!expected)
+		fprintf(stderr, "%s: not a binary PBM or PGM image\n", artwork_path);
+	else if (!packed_image_from_blob(blob, blob_size, &image))
+		fprintf(stderr, "%s: malformed blob\n", blob_path);
+	else if (image.width != width || image.height != height)
+	{
+		fprintf(stderr, "%s: %dx%d, the artwork is %dx%d\n", blob_path,
+				(int) image.width, (int) image.height, width, height);
+	}
+	else if ((bitmap = decode_packed_image(image)) == NULL)
+		fprintf(stderr, "%s: does not decode\n", blob_path);
+	else
+	{
+		const uint8 *bits = (const uint8 *) bitmap->Bits();
+		int32 bpr = bitmap->BytesPerRow();
+
+		int y = 0;
+		while (y < height && memcmp(bits + y * bpr, expected + y * width,
+									width) == 0)
+			y++;
+
+		if (y < height)
+			fprintf(stderr, "%s: row %d differs from the artwork\n",
+					blob_path, y);
+		else if (pixel_checksum(bits, bpr, width, height) != image.checksum)
+			fprintf(stderr, "%s: pixels match, the checksum does not\n",
+					blob_path);
+		else
+		{
+			printf("%-16s %4dx%-4d %d bpp%s  ok\n", blob_path, width, height,
+				   (int) image.depth, image.compressed ? ", PackBits" : "");
+			ok = true;
+		}
+	}
+
+	delete bitmap;
+	free(expected);
+	free(artwork);
+	free(blob);
+	return ok;
+}
+
+int main()
+{
+	for (size_t i = 0; i < sizeof(kImages) / sizeof(kImages[0]); i++)
+	{
+		if (!check_image(kImages[i].blob, kImages[i].artwork))
+			return 1;
+	}
+	return 0;
+}
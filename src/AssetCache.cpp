@@ -0,0 +1,534 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * AssetCache: the artwork decoded to B_RGB32 and scaled, shared by every
+ * BSOD instance in the process, so the preview, the saver itself and
+ * later activations decode an image once.  Scaled bitmaps are reference
+ * counted; ones nobody uses are kept for the next Get(), the least
+ * recently used ones going first once they exceed the byte budget.  All
+ * of it is thread safe.
+ *
+ * Where an image is blown up two times or more, a worker thread scales
+ * it again with the pixel art scaler (see PixelScaler.h) while Get()
+ * hands out the plain stretched copy, which the smooth one replaces once
+ * it is done; Generation() tells the users when to ask again.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Autolock.h>
+#include <Bitmap.h>
+
+#include "AssetCache.h"
+#include "PackedImage.h"
+#include "PaletteExpander.h"
+#include "PixelScaler.h"
+
+static BLocker sCacheLock("BSOD asset cache");
+static AssetCache *sCache = NULL;
+static int32 sCacheUsers = 0;
+
+static inline uint32 pack_rgb32(rgb_color color)
+{
+	// B_RGB32 is stored as B, G, R, A in memory on every host
+	uint8 bytes[4] = { color.blue, color.green, color.red, 255 };
+	uint32 pixel;
+	memcpy(&pixel, bytes, sizeof(pixel));
+	return pixel;
+}
+
+// Converts a B_CMAP8 bitmap into a new B_RGB32 one, through the system
+// palette.
+static BBitmap *expand_bitmap(const BBitmap *source)
+{
+	BBitmap *expanded = new BBitmap(source->Bounds(), B_RGB32);
+	if (expanded->InitCheck() != B_OK)
+	{
+		delete expanded;
+		return NULL;
+	}
+
+	const rgb_color *colors = system_colors()->color_list;
+	uint32 palette[256];
+	for (int i = 0; i < 256; i++)
+		palette[i] = pack_rgb32(colors[i]);
+
+	// B_CMAP8 rows are padded to four bytes, so go row by row
+	const uint8 *src = (const uint8 *) source->Bits();
+	int32 src_bpr = source->BytesPerRow();
+	uint8 *dst = (uint8 *) expanded->Bits();
+	int32 dst_bpr = expanded->BytesPerRow();
+	int32 width = source->Bounds().IntegerWidth() + 1;
+	int32 height = source->Bounds().IntegerHeight() + 1;
+
+	for (int32 y = 0; y < height; y++)
+		expand_palette((uint32 *) (dst + y * dst_bpr), src + y * src_bpr,
+					   width, palette);
+
+	return expanded;
+}
+
+// Nearest neighbour scaling of a B_RGB32 bitmap into a new one,
+// sampling the middle of each target pixel.  At integer factors every
+// source pixel becomes an equally sized block.  The scaled image is
+// repeated 'count' times, 'step' pixels apart.
+static BBitmap *scale_bitmap(const BBitmap *source, int32 width, int32 height,
+							 int32 count, int32 step, rgb_color background)
+{
+	BBitmap *scaled = new BBitmap(BRect(0, 0, (count - 1) * step + width - 1,
+										height - 1), B_RGB32);
+	int32 *columns = (int32 *) malloc(width * sizeof(int32));
+	if (scaled->InitCheck() != B_OK || !columns)
+	{
+		delete scaled;
+		free(columns);
+		return NULL;
+	}
+
+	int32 source_width = source->Bounds().IntegerWidth() + 1;
+	int32 source_height = source->Bounds().IntegerHeight() + 1;
+	for (int32 x = 0; x < width; x++)
+		columns[x] = (int32) ((2 * (int64) x + 1) * source_width / (2 * width));
+
+	const uint8 *src = (const uint8 *) source->Bits();
+	int32 src_bpr = source->BytesPerRow();
+	uint8 *dst = (uint8 *) scaled->Bits();
+	int32 dst_bpr = scaled->BytesPerRow();
+
+	int32 row_width = scaled->Bounds().IntegerWidth() + 1;
+	uint32 fill = pack_rgb32(background);
+
+	int32 last = -1;
+	for (int32 y = 0; y < height; y++)
+	{
+		int32 row = (int32) ((2 * (int64) y + 1) * source_height / (2 * height));
+		uint32 *out = (uint32 *) (dst + y * dst_bpr);
+
+		// rows from the same source row are the same
+		if (row == last)
+		{
+			memcpy(out, dst + (y - 1) * dst_bpr, row_width * sizeof(uint32));
+			continue;
+		}
+
+		const uint32 *in = (const uint32 *) (src + row * src_bpr);
+		for (int32 x = 0; x < width; x++)
+			out[x] = in[columns[x]];
+		for (int32 x = width; x < step && x < row_width; x++)
+			out[x] = fill;
+		for (int32 i = 1; i < count; i++)
+		{
+			memcpy(out + i * step, out,
+				   (i < count - 1 ? step : width) * sizeof(uint32));
+		}
+		last = row;
+	}
+
+	free(columns);
+	return scaled;
+}
+
+// Blows a B_RGB32 bitmap up with the pixel art scaler, by the largest
+// factor it has that stays within width x height, into a new one; NULL
+// if that is below two or out of memory.
+static BBitmap *upscale_bitmap(const BBitmap *source, int32 width,
+							   int32 height)
+{
+	int32 source_width = source->Bounds().IntegerWidth() + 1;
+	int32 source_height = source->Bounds().IntegerHeight() + 1;
+	int32 factors[kMaxPixelArtPasses];
+	int32 passes = pixel_art_passes(min_c(width / source_width,
+										  height / source_height), factors);
+	int32 threads = pixel_art_threads();
+
+	const BBitmap *from = source;
+	BBitmap *upscaled = NULL;
+	for (int32 i = 0; i < passes; i++)
+	{
+		int32 from_width = from->Bounds().IntegerWidth() + 1;
+		int32 from_height = from->Bounds().IntegerHeight() + 1;
+		BBitmap *to = new BBitmap(BRect(0, 0, from_width * factors[i] - 1,
+										from_height * factors[i] - 1),
+								  B_RGB32);
+		if (to->InitCheck() != B_OK)
+		{
+			delete to;
+			delete upscaled;
+			return NULL;
+		}
+
+		scale_pixel_art((uint32 *) to->Bits(), to->BytesPerRow(),
+						(const uint32 *) from->Bits(), from->BytesPerRow(),
+						from_width, from_height, factors[i], threads);
+		delete upscaled;
+		upscaled = to;
+		from = to;
+	}
+
+	return upscaled;
+}
+
+AssetCache *AssetCache::Acquire()
+{
+	BAutolock lock(sCacheLock);
+	if (!sCache)
+		sCache = new AssetCache;
+	sCacheUsers++;
+	return sCache;
+}
+
+void AssetCache::Release()
+{
+	BAutolock lock(sCacheLock);
+	if (--sCacheUsers == 0)
+	{
+		delete sCache;
+		sCache = NULL;
+	}
+}
+
+AssetCache::AssetCache()
+	:
+	m_lock("BSOD assets")
+{
+	m_bytes = 0;
+	m_budget = kDefaultBudget;
+	m_generation = 0;
+	m_hits = m_misses = m_decodes = m_evictions = m_upscales = 0;
+	m_upscale_time = 0;
+}
+
+AssetCache::~AssetCache()
+{
+	// the workers use the sources and add to the lists, so wait for them
+	for (;;)
+	{
+		m_lock.Lock();
+		job *j = (job *) m_jobs.FirstItem();
+		thread_id thread = j ? j->thread : -1;
+		m_lock.Unlock();
+		if (thread < 0)
+			break;
+
+		status_t result;
+		wait_for_thread(thread, &result);
+	}
+
+	for (int32 i = 0; i < m_variants.CountItems(); i++)
+	{
+		variant *v = (variant *) m_variants.ItemAt(i);
+		delete v->bitmap;
+		delete v;
+	}
+
+	for (int32 i = 0; i < m_sources.CountItems(); i++)
+	{
+		source *s = (source *) m_sources.ItemAt(i);
+		delete s->bitmap;
+		delete s;
+	}
+}
+
+AssetCache::source *AssetCache::find_source(const packed_image &image)
+{
+	for (int32 i = 0; i < m_sources.CountItems(); i++)
+	{
+		source *s = (source *) m_sources.ItemAt(i);
+		if (s->checksum == image.checksum && s->width == image.width
+			&& s->height == image.height)
+			return s;
+	}
+
+	// converted to B_RGB32 once, rather than by every scaling
+	BBitmap *packed = decode_packed_image(image);
+	if (!packed)
+		return NULL;
+	BBitmap *bitmap = expand_bitmap(packed);
+	delete packed;
+	if (!bitmap)
+		return NULL;
+
+	source *s = new source;
+	s->checksum = image.checksum;
+	s->width = image.width;
+	s->height = image.height;
+	s->bitmap = bitmap;
+	s->bytes = bitmap->BitsLength();
+	m_sources.AddItem(s);
+	m_bytes += s->bytes;
+	m_decodes++;
+	return s;
+}
+
+const BBitmap *AssetCache::Get(const packed_image &image, int32 width,
+							   int32 height, int32 count, int32 step,
+							   rgb_color background)
+{
+	// copies must not overlap, which is also what keeps step positive
+	if (width <= 0 || height <= 0 || count <= 0 || step < width)
+		return NULL;
+
+	BAutolock lock(m_lock);
+
+	source *s = find_source(image);
+	if (!s)
+		return NULL;
+
+	// the smooth copy if there is one
+	int32 found = -1;
+	for (int32 i = 0; i < m_variants.CountItems(); i++)
+	{
+		variant *v = (variant *) m_variants.ItemAt(i);
+		if (v->from == s && v->width == width && v->height == height
+			&& v->count == count && (count == 1 || (v->step == step
+				&& v->background == background)))
+		{
+			found = i;
+			if (v->smooth)
+				break;
+		}
+	}
+
+	if (found >= 0)
+	{
+		variant *v = (variant *) m_variants.RemoveItem(found);
+		m_hits++;
+		v->references++;
+		m_variants.AddItem(v);
+		return v->bitmap;
+	}
+
+	m_misses++;
+	BBitmap *bitmap = scale_bitmap(s->bitmap, width, height, count, step,
+								   background);
+	if (!bitmap)
+		return NULL;
+
+	variant *v = new variant;
+	v->from = s;
+	v->width = width;
+	v->height = height;
+	v->count = count;
+	v->step = step;
+	v->background = background;
+	v->bitmap = bitmap;
+	v->bytes = bitmap->BitsLength();
+	v->references = 1;
+	v->smooth = false;
+	m_variants.AddItem(v);
+	m_bytes += v->bytes;
+
+	start_upscale(v);
+	evict();
+	return bitmap;
+}
+
+// Has a worker make the smooth copy of a stretched variant, if it is
+// blown up enough for that to show and no one is at it yet.
+void AssetCache::start_upscale(const variant *v)
+{
+	if (v->width < 2 * v->from->width || v->height < 2 * v->from->height)
+		return;
+
+	for (int32 i = 0; i < m_jobs.CountItems(); i++)
+	{
+		job *j = (job *) m_jobs.ItemAt(i);
+		if (j->from == v->from && j->width == v->width
+			&& j->height == v->height && j->count == v->count
+			&& j->step == v->step && j->background == v->background)
+			return;
+	}
+
+	job *j = new job;
+	j->cache = this;
+	j->from = v->from;
+	j->width = v->width;
+	j->height = v->height;
+	j->count = v->count;
+	j->step = v->step;
+	j->background = v->background;
+	j->thread = spawn_thread(upscale_thread, "BSOD pixel art",
+							 B_LOW_PRIORITY, j);
+	if (j->thread < 0)
+	{
+		delete j;
+		return;
+	}
+
+	// listed before it runs, as it takes itself off the list when done
+	m_jobs.AddItem(j);
+	resume_thread(j->thread);
+}
+
+status_t AssetCache::upscale_thread(void *data)
+{
+	job *j = (job *) data;
+	bigtime_t start = system_time();
+
+	// the source bitmap is not evicted while the job is listed
+	BBitmap *bitmap = NULL;
+	BBitmap *upscaled = upscale_bitmap(j->from->bitmap, j->width, j->height);
+	if (upscaled)
+	{
+		bitmap = scale_bitmap(upscaled, j->width, j->height, j->count,
+							  j->step, j->background);
+		delete upscaled;
+	}
+
+	j->cache->finish_upscale(j, bitmap, system_time() - start);
+	return B_OK;
+}
+
+void AssetCache::finish_upscale(job *j, BBitmap *bitmap, bigtime_t elapsed)
+{
+	BAutolock lock(m_lock);
+	m_jobs.RemoveItem(j);
+
+	// It would be evicted right away if it does not fit, and then asked
+	// for again; the stretched copy will do.
+	if (bitmap && m_bytes + bitmap->BitsLength() <= m_budget)
+	{
+		variant *v = new variant;
+		v->from = j->from;
+		v->width = j->width;
+		v->height = j->height;
+		v->count = j->count;
+		v->step = j->step;
+		v->background = j->background;
+		v->bitmap = bitmap;
+		v->bytes = bitmap->BitsLength();
+		v->references = 0;
+		v->smooth = true;
+		m_variants.AddItem(v);
+		m_bytes += v->bytes;
+		m_upscales++;
+		m_upscale_time += elapsed;
+		atomic_add(&m_generation, 1);
+	}
+	else
+		delete bitmap;
+
+	delete j;
+}
+
+void AssetCache::Put(const BBitmap *bitmap)
+{
+	BAutolock lock(m_lock);
+
+	for (int32 i = 0; i < m_variants.CountItems(); i++)
+	{
+		variant *v = (variant *) m_variants.ItemAt(i);
+		if (v->bitmap == bitmap)
+		{
+			v->references--;
+			break;
+		}
+	}
+
+	evict();
+}
+
+void AssetCache::SetBudget(size_t bytes)
+{
+	BAutolock lock(m_lock);
+	m_budget = bytes;
+	evict();
+}
+
+size_t AssetCache::Bytes()
+{
+	BAutolock lock(m_lock);
+	return m_bytes;
+}
+
+void AssetCache::evict()
+{
+	for (int32 i = 0; m_bytes > m_budget && i < m_variants.CountItems(); )
+	{
+		variant *v = (variant *) m_variants.ItemAt(i);
+		if (v->references > 0)
+		{
+			i++;
+			continue;
+		}
+
+		m_variants.RemoveItem(i);
+		m_bytes -= v->bytes;
+		m_evictions++;
+		delete v->bitmap;
+		delete v;
+	}
+
+	// then the images decoded for scaled copies that are all gone
+	for (int32 i = 0; m_bytes > m_budget && i < m_sources.CountItems(); )
+	{
+		source *s = (source *) m_sources.ItemAt(i);
+		if (in_use(s))
+		{
+			i++;
+			continue;
+		}
+
+		m_sources.RemoveItem(i);
+		m_bytes -= s->bytes;
+		m_evictions++;
+		delete s->bitmap;
+		delete s;
+	}
+}
+
+// Whether a scaled copy of 's' is kept or being made; the copies are
+// told apart by the source they point to.
+bool AssetCache::in_use(const source *s) const
+{
+	for (int32 i = 0; i < m_variants.CountItems(); i++)
+	{
+		if (((variant *) m_variants.ItemAt(i))->from == s)
+			return true;
+	}
+
+	for (int32 i = 0; i < m_jobs.CountItems(); i++)
+	{
+		if (((job *) m_jobs.ItemAt(i))->from == s)
+			return true;
+	}
+
+	return false;
+}
+
+int32 AssetCache::Hits()
+{
+	BAutolock lock(m_lock);
+	return m_hits;
+}
+
+int32 AssetCache::Misses()
+{
+	BAutolock lock(m_lock);
+	return m_misses;
+}
+
+int32 AssetCache::Decodes()
+{
+	BAutolock lock(m_lock);
+	return m_decodes;
+}
+
+int32 AssetCache::Evictions()
+{
+	BAutolock lock(m_lock);
+	return m_evictions;
+}
+
+int32 AssetCache::Upscales()
+{
+	BAutolock lock(m_lock);
+	return m_upscales;
+}
+
+bigtime_t AssetCache::UpscaleTime()
+{
+	BAutolock lock(m_lock);
+	return m_upscale_time;
+}
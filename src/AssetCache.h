@@ -0,0 +1,111 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * AssetCache: the artwork decoded to B_RGB32 and scaled, shared by every
+ * BSOD instance in the process, so the preview, the saver itself and
+ * later activations decode an image once.  Scaled bitmaps are reference
+ * counted; ones nobody uses are kept for the next Get(), the least
+ * recently used ones going first once they exceed the byte budget.  The
+ * decoded images count against the budget as well, and go once no scaled
+ * copy of them is left.  All of it is thread safe.
+ *
+ * Where an image is blown up two times or more, a worker thread scales
+ * it again with the pixel art scaler (see PixelScaler.h) while Get()
+ * hands out the plain stretched copy, which the smooth one replaces once
+ * it is done; Generation() tells the users when to ask again.
+ */
+
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <GraphicsDefs.h>
+#include <List.h>
+#include <Locker.h>
+#include <OS.h>
+#include <SupportDefs.h>
+
+class BBitmap;
+struct packed_image;
+
+class AssetCache {
+ public:
+	// the cache, created by the first user and deleted by the last
+	static AssetCache *Acquire();
+	static void Release();
+
+	// A reference to the image scaled to width x height, 'count' times
+	// side by side with the left edges 'step' pixels apart and any gap
+	// filled with 'background'; NULL if out of memory.  Put() it back
+	// when done with it.  This is the smooth copy if there is one, else
+	// the stretched one, and then the smooth one is made in the
+	// background.
+	const BBitmap *Get(const packed_image &image, int32 width, int32 height,
+					   int32 count, int32 step, rgb_color background);
+	void Put(const BBitmap *bitmap);
+	// Goes up whenever a smooth copy is added, after which Get() may
+	// return a better bitmap than before; it needs no locking.
+	int32 Generation() { return atomic_get(&m_generation); }
+
+	// Bounds the scaled bitmaps nobody uses; ones in use are never
+	// evicted, so the total may go above it.
+	void SetBudget(size_t bytes);
+	size_t Bytes();
+
+	int32 Hits();
+	int32 Misses();
+	int32 Decodes();
+	int32 Evictions();
+	int32 Upscales();
+	bigtime_t UpscaleTime();
+
+	enum { kDefaultBudget = 32 * 1024 * 1024 };
+
+ private:
+	AssetCache();
+	~AssetCache();
+
+	// an image, told apart by the checksum and size of its pixels
+	struct source {
+		uint32 checksum;
+		int32 width, height;
+		BBitmap *bitmap;	// B_RGB32
+		size_t bytes;
+	};
+
+	struct variant {
+		const source *from;
+		int32 width, height, count, step;
+		rgb_color background;
+		BBitmap *bitmap;
+		size_t bytes;
+		int32 references;
+		bool smooth;		// made by the pixel art scaler
+	};
+
+	// a smooth copy being made
+	struct job {
+		AssetCache *cache;
+		const source *from;
+		int32 width, height, count, step;
+		rgb_color background;
+		thread_id thread;
+	};
+
+	source *find_source(const packed_image &image);
+	void start_upscale(const variant *v);
+	void finish_upscale(job *j, BBitmap *bitmap, bigtime_t elapsed);
+	static status_t upscale_thread(void *data);
+	void evict();
+	bool in_use(const source *s) const;
+
+	BLocker m_lock;
+	BList m_sources;
+	BList m_variants;	// least recently used first
+	BList m_jobs;
+	size_t m_bytes, m_budget;
+	int32 m_generation;
+	int32 m_hits, m_misses, m_decodes, m_evictions, m_upscales;
+	bigtime_t m_upscale_time;
+};
+
+#endif // ASSET_CACHE_H
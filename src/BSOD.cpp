@@ -50,11 +50,10 @@
 #include <Node.h>
 #include <NodeInfo.h>
 
-#include "BSOD.h"
+#include <Debug.h>
 
-#include "amiga_hand.h"
-#include "atari.h"
-#include "mac.h"
+#include "AssetCache.h"
+#include "BSOD.h"
 
 static const char* TITLE =
 	"Blue Screen Of Death for BeOS v1.02\n";
@@ -73,14 +72,31 @@ extern "C" _EXPORT BScreenSaver *instantiate_screen_saver(BMessage *message, ima
 }
 
 BSOD::BSOD(BMessage *msg, image_id image)
- : BScreenSaver(msg, image)
+ : BScreenSaver(msg, image),
+   m_modes(kModeCount)
 {
-	m_bitmap = NULL;
 	m_icon = NULL;
 	m_image = image;
 	m_preview = false;
+
+	m_current = &m_renderers[0];
+	m_ahead = &m_renderers[1];
+	m_ahead_thread = -1;
+	m_ahead_done = 0;
+
+	m_prerenders = 0;
+	m_prerender_time = 0;
+	for (int i = 0; i < 2; i++)
+	{
+		m_transitions[i] = 0;
+		m_transition_time[i] = m_transition_worst[i] = 0;
+	}
+
+	m_draw_count = 0;
+	m_draw_time = m_draw_worst = 0;
+	reset_wakeups();
 	
-	m_method = 0;
+	m_prepared = false;
 
 	RestoreState(msg);
 
@@ -89,6 +105,8 @@ BSOD::BSOD(BMessage *msg, image_id image)
 }
 
 BSOD::~BSOD() {
+	// in case the saver goes away without StopSaver()
+	finish_ahead(true);
 }
 
 void BSOD::StartConfig(BView *view)
@@ -124,17 +142,37 @@ status_t BSOD::StartSaver(BView * view, bool preview)
 		}
 	}
 	
-	m_method = m_type;
-	if (m_type == 8)
-		m_method = rand() % 8;
+	// the artwork is only read once a mode draws it; the cap bounds the
+	// artwork no mode holds as well
+	image_info info;
+	bool found = get_image_info(m_image, &info) == B_OK;
+	size_t cap = (size_t) m_memory_cap * 1024 * 1024;
+	size_t budget = (size_t) m_asset_budget * 1024 * 1024;
+	m_current->Images().Shared()->SetBudget(cap > 0 && cap < budget ? cap
+											: budget);
+	for (int i = 0; i < 2; i++)
+	{
+		if (found)
+			m_renderers[i].SetArtwork(info.name);
+		m_renderers[i].SetBombs(m_bombs);
+		m_renderers[i].SetCap(cap, &m_renderers[1 - i]);
+	}
 
-	m_bitmap = NULL;
+	srand(real_time_clock());
 
-	// stuff for random cycling
-	time_t now = real_time_clock();
-	srand(now);
-	m_last_reset = now;
-	m_starting_frame = -1;
+	int32 mode = m_type;
+	if (m_type == 8)
+		mode = m_modes.Next();
+	m_current->SetMode(mode);
+
+	// the random cycle
+	if (m_type == 9)
+	{
+		Lock();
+		m_cycle.Start(system_time(), m_interval * 1000000LL);
+		Unlock();
+		begin_cycle(view->Bounds());
+	}
 
 	SetTickSize(100000);
 
@@ -143,22 +181,172 @@ status_t BSOD::StartSaver(BView * view, bool preview)
 
 void BSOD::StopSaver() 
 {
+	// The config view may have changed m_type while the cycle ran, so the
+	// worker is joined whatever the type is now.
+	finish_ahead(true);
+
+	if (m_type == 9 && !m_preview)
+	{
+		end_cycle();
+		Lock();
+		if (m_cycle.Cycles() > 0)
+		{
+			PRINT(("BSOD: %" B_PRId32 " cycles, switched %" B_PRIdBIGTIME
+				   " us late on average, %" B_PRIdBIGTIME " us worst, %"
+				   B_PRIdBIGTIME " us jitter\n", m_cycle.Cycles(),
+				   m_cycle.AverageLatency(), m_cycle.WorstLatency(),
+				   m_cycle.Jitter()));
+		}
+		m_cycle.ResetStats();
+		Unlock();
+
+		if (m_prerenders > 0)
+		{
+			PRINT(("BSOD: %" B_PRId32 " crashes drawn ahead in %" B_PRIdBIGTIME
+				   " us on average\n", m_prerenders,
+				   m_prerender_time / m_prerenders));
+		}
+		for (int i = 0; i < 2; i++)
+		{
+			if (m_transitions[i] == 0)
+				continue;
+			PRINT(("BSOD: %" B_PRId32 " switches %s, up in %" B_PRIdBIGTIME
+				   " us on average, %" B_PRIdBIGTIME " us worst\n",
+				   m_transitions[i], i == 1 ? "drawn ahead" : "drawn in place",
+				   m_transition_time[i] / m_transitions[i],
+				   m_transition_worst[i]));
+		}
+		m_prerenders = 0;
+		m_prerender_time = 0;
+		for (int i = 0; i < 2; i++)
+		{
+			m_transitions[i] = 0;
+			m_transition_time[i] = m_transition_worst[i] = 0;
+		}
+	}
+
 	if (m_icon)
 		delete m_icon;
-	if (m_bitmap)
-		delete m_bitmap;
-	m_icon = m_bitmap = NULL;
+	m_icon = NULL;
+
+	int32 font_hits = 0, font_misses = 0;
+	int32 image_hits = 0, image_misses = 0;
+	int32 frames = 0, requests = 0, calls = 0, max_calls = 0;
+	for (int r = 0; r < 2; r++)
+	{
+		CrashRenderer &renderer = m_renderers[r];
+		const MemoryLedger &ledger = renderer.Ledger();
+		if (ledger.Peak() > 0)
+		{
+			PRINT(("BSOD: renderer %d memory %zu bytes held, %zu peak, %zu "
+				   "cap with the other, %" B_PRId32 " allocations refused\n",
+				   r, ledger.Current(), ledger.Peak(), ledger.Cap(),
+				   ledger.Refusals()));
+			for (int i = 0; i < MemoryLedger::kCategoryCount; i++)
+			{
+				PRINT(("BSOD:   %-8s %zu bytes held, %zu peak\n",
+					   MemoryLedger::CategoryName((MemoryLedger::category) i),
+					   ledger.Current((MemoryLedger::category) i),
+					   ledger.Peak((MemoryLedger::category) i)));
+			}
+			for (int i = 0; i < kModeCount; i++)
+			{
+				if (ledger.ModePeak(i) > 0)
+					PRINT(("BSOD:   mode %d peak %zu bytes\n", i,
+						   ledger.ModePeak(i)));
+			}
+		}
+
+		font_hits += renderer.FontHits();
+		font_misses += renderer.FontMisses();
+		image_hits += renderer.Images().Hits();
+		image_misses += renderer.Images().Misses();
+
+		const DrawBatch &batch = renderer.Batch();
+		frames += batch.Frames();
+		requests += batch.Requests();
+		calls += batch.Calls();
+		if (batch.MaxCalls() > max_calls)
+			max_calls = batch.MaxCalls();
+	}
+
+	if (font_hits + font_misses > 0)
+	{
+		PRINT(("BSOD: font context %" B_PRId32 " hits, %" B_PRId32 " misses\n",
+			   font_hits, font_misses));
+	}
+
+	if (image_hits + image_misses > 0)
+	{
+		PRINT(("BSOD: scaled images %" B_PRId32 " hits, %" B_PRId32 " misses; "
+			   "shared %" B_PRId32 " hits, %" B_PRId32 " misses, %" B_PRId32
+			   " decodes, %" B_PRId32 " evictions, %zu bytes; %" B_PRId32
+			   " upscaled in %" B_PRIdBIGTIME " us\n",
+			   image_hits, image_misses,
+			   m_current->Images().Shared()->Hits(),
+			   m_current->Images().Shared()->Misses(),
+			   m_current->Images().Shared()->Decodes(),
+			   m_current->Images().Shared()->Evictions(),
+			   m_current->Images().Shared()->Bytes(),
+			   m_current->Images().Shared()->Upscales(),
+			   m_current->Images().Shared()->UpscaleTime()));
+	}
+
+	// the scaled images go back to the shared cache, which keeps them for
+	// the next activation
+	for (int r = 0; r < 2; r++)
+	{
+		m_renderers[r].Unset();
+		m_renderers[r].ResetStats();
+	}
+
+	if (m_draw_count > 0)
+	{
+		PRINT(("BSOD: %" B_PRId32 " frames, %" B_PRIdBIGTIME " us average, "
+			   "%" B_PRIdBIGTIME " us worst\n",
+			   m_draw_count, m_draw_time / m_draw_count, m_draw_worst));
+	}
+	m_draw_count = 0;
+	m_draw_time = m_draw_worst = 0;
+
+	if (m_wakeup_last > 0)
+	{
+		count_wakeup(system_time());
+		for (int i = 0; i < kModeCount; i++)
+		{
+			if (m_wakeups[i] == 0)
+				continue;
+			PRINT(("BSOD: mode %d woke up %" B_PRId32 " times in %"
+				   B_PRIdBIGTIME " ms, %.2f per second\n", i, m_wakeups[i],
+				   m_mode_time[i] / 1000,
+				   m_mode_time[i] > 0
+					   ? m_wakeups[i] * 1000000.0 / m_mode_time[i] : 0.0));
+		}
+	}
+	reset_wakeups();
+
+	if (frames > 0)
+	{
+		PRINT(("BSOD: app_server calls per frame: %" B_PRId32 " unbatched "
+			   "(estimated), %" B_PRId32 " batched, %" B_PRId32 " worst\n",
+			   requests / frames, calls / frames, max_calls));
+	}
 }
 
 status_t BSOD::SaveState(BMessage *msg) const
 {
 	msg->AddInt32("type", m_type);
 	msg->AddInt32("interval", m_interval);
+	msg->AddInt32("bombs", m_bombs);
+	msg->AddInt32("asset budget", m_asset_budget);
+	msg->AddInt32("memory cap", m_memory_cap);
+	for (int32 i = 0; i < kModeCount; i++)
+		msg->AddInt32("weights", m_modes.Weight(i));
 	return B_OK;
 }
 
 void BSOD::RestoreState(BMessage *msg) {
-	int32 type, interval;
+	int32 type, interval, bombs, budget, cap;
 	
 	if (msg->FindInt32("type", &type) == B_OK)
 		m_type = type;
@@ -169,6 +357,35 @@ void BSOD::RestoreState(BMessage *msg) {
 		m_interval = interval;
 	else
 		m_interval = 30;
+
+	// not in the config view yet (see the README), ten bombs unless set
+	if (msg->FindInt32("bombs", &bombs) == B_OK && bombs > 0
+		&& bombs <= kMaxBombs)
+		m_bombs = bombs;
+	else
+		m_bombs = 10;
+
+	// megabytes, not in the config view either
+	if (msg->FindInt32("asset budget", &budget) == B_OK && budget >= 0)
+		m_asset_budget = budget;
+	else
+		m_asset_budget = AssetCache::kDefaultBudget / (1024 * 1024);
+
+	// megabytes as well, 0 for no cap
+	if (msg->FindInt32("memory cap", &cap) == B_OK && cap >= 0)
+		m_memory_cap = cap;
+	else
+		m_memory_cap = 0;
+
+	// how often each mode comes up in the random ones, one per mode, 1
+	// unless set and not in the config view either
+	for (int32 i = 0; i < kModeCount; i++)
+	{
+		int32 weight;
+		if (msg->FindInt32("weights", i, &weight) != B_OK)
+			weight = 1;
+		m_modes.SetWeight(i, weight);
+	}
 }
 
 void BSOD::Draw(BView *view, int32 frame)
@@ -187,812 +404,191 @@ void BSOD::Draw(BView *view, int32 frame)
 	}
 	else
 	{
+		bool starting = frame == 0;
+		bool switched = false;
+		bool ahead = false;
+
 		if (m_type == 9) 
 		{
+			// reaps the worker if it is done, never waits for it
+			finish_ahead(false);
+
 			Lock();
-			
-			time_t now = real_time_clock();
-						
-			if (now > m_last_reset + m_interval) 
-			{
-				m_last_reset = now;
-				m_starting_frame = frame;
-			}
-			
-			if (m_starting_frame > 0) 
-				frame = frame % m_starting_frame;
-			
-			if (frame == 0)
+			m_cycle.SetInterval(m_interval * 1000000LL);
+			bool over = m_cycle.Advance(system_time());
+			Unlock();
+
+			if (over)
 			{
-				delete m_bitmap;
-				m_bitmap = NULL;
-				m_method = rand() % 8;
+				end_cycle();
+				ahead = begin_cycle(view->Bounds());
+				starting = true;
+				switched = true;
 			}
-			
-			Unlock();
 		}
-			
-		switch (m_method)
-		{
-			case 0:
-				Windows(view, true, frame);
-				break;
-			case 1:
-				Windows(view, false, frame);
-				break;
-			case 2:
-				SCO(view, frame);
-				break;
-			case 3:
-				SparcLinux(view, frame);
-				break;
-			case 4:
-				Amiga(view, frame);
-				break;
-			case 5:
-				Atari(view, frame);
-				break;
-			case 6:
-				Mac(view, frame);
-				break;
-			case 7:
-				MacsBug(view, frame);
-				break;
-			default:
-				break;
-		}
-	}
-}
 
-void BSOD::draw_string (BView *view, BFont *font, int xoff, int yoff,
-	 				    int win_width, int win_height, const char *string, int delay)
-{
-	int x, y;
-	int width = 0, height = 0, cw = 0;
-	int char_width, line_height;
-	
-	const char *s = string;
-	const char *se = string;
+		bigtime_t start = system_time();
+		count_wakeup(start);
 
-	rgb_color foreground = view->HighColor();
-	rgb_color background = view->LowColor();
-	
-	// this assumes fixed-width fonts
-	char_width = (int) font->StringWidth("W");
-	font_height info;
-	font->GetHeight(&info);
-	line_height = (int) (info.ascent + info.descent + 1);
-
-	while (1)
-    {
-		if (*s == '\n' || !*s)
-		{
-			height++;
-			if (cw > width) width = cw;
-				cw = 0;
-			if (!*s) break;
-		}
+		// the crash drawn ahead carries on from its first keyframe
+		if (ahead)
+			m_current->ShowAhead(view);
 		else
-			cw++;
-		s++;
-	}
-
-	x = (win_width - (width * char_width)) / 2;
-	y = (win_height - (height * line_height)) / 2;
+			m_current->Draw(view, starting);
 
-	if (x < 0) x = 2;
-	if (y < 0) y = 2;
-
-	x += xoff;
-	y += yoff;
-
-	se = s = string;
-	while (1)
-	{
-		if (*s == '\n' || !*s)
+		// The next crash of the cycle is drawn ahead while this one is up,
+		// once it has nothing more due before the switch or the switch
+		// is kPrepareAhead away, whichever comes first.
+		bigtime_t tick = m_current->UntilNext();
+		if (m_type == 9)
 		{
-			int off = 0;
-			bool flip = false;
-
-			if (*se == '@' || *se == '_')
-			{
-				if (*se == '@') flip = true;
-				se++;
-				off = (char_width * (width - (s - se))) / 2;
-			}
-
-			if (flip)
-			{
-				view->SetHighColor(background);
-				view->SetLowColor(foreground);
-				
-				view->FillRect(BRect(x+off-1, y+1, 
-									 x+off+((s-se)*char_width), y+info.ascent+1),
-							   B_SOLID_LOW);
-			}
-	
-			if (s != se)
-				view->DrawString(se, s-se, BPoint(x+off, y+info.ascent));
+			Lock();
+			bigtime_t now = system_time();
+			bigtime_t left = m_cycle.UntilDeadline(now);
+			bigtime_t up = m_cycle.Elapsed(now);
+			Unlock();
 
-			if (flip)
+			if (switched)
 			{
-				view->SetHighColor(foreground);
-				view->SetLowColor(background);
+				m_transitions[ahead]++;
+				m_transition_time[ahead] += up;
+				if (up > m_transition_worst[ahead])
+					m_transition_worst[ahead] = up;
 			}
 
-			se = s;
-			y += line_height;
-			if (!*s) break;
-			se = s+1;
-
-			if (delay > 0)
+			if (!m_prepared && (tick >= left || left <= kPrepareAhead))
 			{
-				view->Sync();
-				snooze(delay);
+				start_ahead(view->Bounds());
+				m_prepared = true;
 			}
+			else if (!m_prepared && tick > left - kPrepareAhead)
+				tick = left - kPrepareAhead;
 
+			if (tick > left)
+				tick = left;
 		}
-		s++;
-	}
-	
-	view->Sync();
-}
 
-void BSOD::Windows(BView *view, bool win95, int32 frame)
-{
-	if (frame == 0)
-	{
-		(win95 ? view->SetViewColor(0,0,165) : view->SetViewColor(0,0,128));
-		view->Invalidate();
-		SetTickSize(50000);
-	}
-	
-	if (frame > 1) 
-		return;
-			
-	const char *w95 = (
-		"\n@ Windows \n\n"
- 		"A fatal exception 0E has occured at 0028:C004D86F in VXD VFAT(01) +\n"
-		"0000B897.  The current application will be terminated.\n"
-		"\n"
-		"* Press any key to terminate the current application.\n"
-		"* Press CTRL+ALT+DELETE again to restart your computer.  You will\n"
-		"  lose any unsaved information in all applications.\n"
-		"\n"
-		"_Press any key to continue _"
-	);
-
-	const char *wnt = ( /* from Jim Niemira <urmane@urmane.org> */
-		"*** STOP: 0x0000001E (0x80000003,0x80106fc0,0x8025ea21,0xfd6829e8)\n"
-		"Unhandled Kernel exception c0000047 from fa8418b4 (8025ea21,fd6829e8)\n"
-		"\n"
-		"Dll Base Date Stamp - Name             Dll Base Date Stamp - Name\n"
-		"80100000 2be154c9 - ntoskrnl.exe       80400000 2bc153b0 - hal.dll\n"
-		"80258000 2bd49628 - ncrc710.sys        8025c000 2bd49688 - SCSIPORT.SYS \n"
-		"80267000 2bd49683 - scsidisk.sys       802a6000 2bd496b9 - Fastfat.sys\n"
-		"fa800000 2bd49666 - Floppy.SYS         fa810000 2bd496db - Hpfs_Rec.SYS\n"
-		"fa820000 2bd49676 - Null.SYS           fa830000 2bd4965a - Beep.SYS\n"
-		"fa840000 2bdaab00 - i8042prt.SYS       fa850000 2bd5a020 - SERMOUSE.SYS\n"
-		"fa860000 2bd4966f - kbdclass.SYS       fa870000 2bd49671 - MOUCLASS.SYS\n"
-		"fa880000 2bd9c0be - Videoprt.SYS       fa890000 2bd49638 - NCC1701E.SYS\n"
-		"fa8a0000 2bd4a4ce - Vga.SYS            fa8b0000 2bd496d0 - Msfs.SYS\n"
-		"fa8c0000 2bd496c3 - Npfs.SYS           fa8e0000 2bd496c9 - Ntfs.SYS\n"
-		"fa940000 2bd496df - NDIS.SYS           fa930000 2bd49707 - wdlan.sys\n"
-		"fa970000 2bd49712 - TDI.SYS            fa950000 2bd5a7fb - nbf.sys\n"
-		"fa980000 2bd72406 - streams.sys        fa9b0000 2bd4975f - ubnb.sys\n"
-		"fa9c0000 2bd5bfd7 - usbser.sys         fa9d0000 2bd4971d - netbios.sys\n"
-		"fa9e0000 2bd49678 - Parallel.sys       fa9f0000 2bd4969f - serial.SYS\n"
-		"faa00000 2bd49739 - mup.sys            faa40000 2bd4971f - SMBTRSUP.SYS\n"
-		"faa10000 2bd6f2a2 - srv.sys            faa50000 2bd4971a - afd.sys\n"
-		"faa60000 2bd6fd80 - rdr.sys            faaa0000 2bd49735 - bowser.sys\n"
-		"\n"
-		"Address dword dump Dll Base                                      - Name\n"
-		"801afc20 80106fc0 80106fc0 00000000 00000000 80149905 : "
-		  "fa840000 - i8042prt.SYS\n"
-		"801afc24 80149905 80149905 ff8e6b8c 80129c2c ff8e6b94 : "
-		  "8025c000 - SCSIPORT.SYS\n"
-		"801afc2c 80129c2c 80129c2c ff8e6b94 00000000 ff8e6b94 : "
-		  "80100000 - ntoskrnl.exe\n"
-		"801afc34 801240f2 80124f02 ff8e6df4 ff8e6f60 ff8e6c58 : "
-		  "80100000 - ntoskrnl.exe\n"
-		"801afc54 80124f16 80124f16 ff8e6f60 ff8e6c3c 8015ac7e : "
-		  "80100000 - ntoskrnl.exe\n"
-		"801afc64 8015ac7e 8015ac7e ff8e6df4 ff8e6f60 ff8e6c58 : "
-		  "80100000 - ntoskrnl.exe\n"
-		"801afc70 80129bda 80129bda 00000000 80088000 80106fc0 : "
-		  "80100000 - ntoskrnl.exe\n"
-		"\n"
-		"Kernel Debugger Using: COM2 (Port 0x2f8, Baud Rate 19200)\n"
-		"Restart and set the recovery options in the system control panel\n"
-		"or the /CRASHDEBUG system start option. If this message reappears,\n"
-		"contact your system administrator or technical support group."
-	);
-	
-	BFont font(be_fixed_font);
-	font.SetFlags(B_DISABLE_ANTIALIASING);
+		// Wake up when the next keyframe falls due, measured from now, or
+		// for the next crash of the random cycle; a crash that is done
+		// changing sleeps for kIdleTick.
+		SetTickSize(tick < kMinTick ? kMinTick : tick > kIdleTick ? kIdleTick : tick);
 
-	if (win95)
-	{
-		font.SetSize(0.021875*view->Bounds().Width());
-
-		view->SetFont(&font);
-		view->SetLowColor(0,0,165);			// blue
-		view->SetHighColor(255,255,255);	// white
-		draw_string(view, &font, 0, 0, (int)view->Bounds().Width(), (int)view->Bounds().Height(), w95, 0);
-	}
-	else
-	{
-		font.SetSize(0.015625*view->Bounds().Width());
-		
-		font.SetFace(B_BOLD_FACE);
-		font.SetSpacing(B_FIXED_SPACING);
-		view->SetFont(&font);		
-		view->SetLowColor(0,0,128);			// dark blue
-		view->SetHighColor(192,192,192);	// white
-    	draw_string(view, &font, 0, 0, 10, 10, wnt, 750);
+		bigtime_t elapsed = system_time() - start;
+		m_draw_count++;
+		m_draw_time += elapsed;
+		if (elapsed > m_draw_worst)
+			m_draw_worst = elapsed;
 	}
 }
 
-void BSOD::SCO(BView* view, int32 frame)
+// The hooks around each crash of the random cycle.  A crash begins with
+// the one the shuffle bag committed to the last time, and commits to the
+// one after it so that it can be drawn ahead.  The crash comes up from
+// m_ahead if it was drawn there for 'bounds' and the worker is done,
+// which is returned; otherwise m_current starts it by its next Draw().
+bool BSOD::begin_cycle(BRect bounds)
 {
-	if (frame == 0)
-	{
-		view->SetViewColor(0,0,0);
-		view->Invalidate();
-		SetTickSize(100000);
-	}
-	
-	int lines_1 = 0, lines_2 = 0, lines_3 = 0, lines_4 = 0;
-	
-	const char *s;
-	
-	const char *sco_panic_1 = (
-		"Unexpected trap in kernel mode:\n"
-		"\n"
-		"cr0 0x80010013     cr2  0x00000014     cr3 0x00000000  tlb  0x00000000\n"
-		"ss  0x00071054    uesp  0x00012055     efl 0x00080888  ipl  0x00000005\n"
-		"cs  0x00092585     eip  0x00544a4b     err 0x004d4a47  trap 0x0000000E\n"
-		"eax 0x0045474b     ecx  0x0042544b     edx 0x57687920  ebx  0x61726520\n"
-		"esp 0x796f7520     ebp  0x72656164     esi 0x696e6720  edi  0x74686973\n"
-		"ds  0x3f000000     es   0x43494c48     fs  0x43525343  gs   0x4f4d4b53\n"
-		"\n"
-		"PANIC: k_trap - kernel mode trap type 0x0000000E\n"
-		"Trying to dump 5023 pages to dumpdev hd (1/41), 63 pages per '.'\n"
-	);
-	const char *sco_panic_2 = (
-		"...............................................................................\n"
-	);
-	const char *sco_panic_3 = (
-		"5023 pages dumped\n"
-		"\n"
-		"\n"
-	);
-	const char *sco_panic_4 = (
-		"**   Safe to Power Off   **\n"
-		"           - or -\n"
-		"** Press Any Key to Reboot **\n"
-	);
-
-	if (frame > (int32)strlen(sco_panic_2) + 9) 
-		return;
-
-
-	for (s = sco_panic_1; *s; s++) if (*s == '\n') lines_1++;
-	for (s = sco_panic_2; *s; s++) if (*s == '\n') lines_2++;
-	for (s = sco_panic_3; *s; s++) if (*s == '\n') lines_3++;
-	for (s = sco_panic_4; *s; s++) if (*s == '\n') lines_4++;
-
-	BFont font(be_fixed_font);
-	font.SetSize(0.015625*view->Bounds().Width());
-	font.SetFlags(B_DISABLE_ANTIALIASING);
-	font.SetFace(B_BOLD_FACE);
-	font.SetSpacing(B_FIXED_SPACING);
-	view->SetFont(&font);
+	int32 mode = m_modes.Next();
+	m_modes.Peek();
+	m_prepared = false;
 
-	view->SetLowColor(0,0,0);			// black
-	view->SetHighColor(255,255,255);	// white
-
-	font_height info;
-	font.GetHeight(&info);
-
-	if (frame == 1) 
-	{
-		draw_string(view, &font,
-					10, (int)(view->Bounds().Height() - ((lines_1 + lines_2 + lines_3 + lines_4 + 1) *
-        	                           (info.ascent + info.descent + 1))),
-					10, 10,
-					sco_panic_1, 0);
-		view->Sync();
-		return;
-	}
-	
-	if (frame > 1 && frame < (int32)strlen(sco_panic_2) + 1)
+	if (m_ahead_thread < 0 && m_ahead->Mode() == mode
+		&& m_ahead->DrawnAhead(bounds))
 	{
-		for (s = sco_panic_2; *s; s++)
-	    {
-			char *ss = strdup(sco_panic_2);
-			ss[frame] = 0;
-			draw_string(view, &font,
-				10, (int)(view->Bounds().Height() - ((lines_2 + lines_3 + lines_4 + 1) *
-					(info.ascent + info.descent + 1))),
-				10, 10,
-				ss, 0);
-	      	view->Sync();
-			free(ss);
-		}
-		return;
+		CrashRenderer *last = m_current;
+		m_current = m_ahead;
+		m_ahead = last;
+		return true;
 	}
 
-	if (frame > (int32)strlen(sco_panic_2) + 2)
-	{
-		draw_string(view, &font,
-			10, (int)(view->Bounds().Height() - ((lines_3 + lines_4 + 1) *
-				(info.ascent + info.descent + 1))),
-			10, 10,
-			sco_panic_3, 0);
-		view->Sync();
-	}
-
-	if (frame > (int32)strlen(sco_panic_2) + 8)
-	{
-		draw_string(view, &font,
-			10, (int)(view->Bounds().Height() - ((lines_4 + 1) *
-				(info.ascent + info.descent + 1))),
-			10, 10,
-			sco_panic_4, 0);
-		view->Sync();	
-	}
+	// a crash drawn ahead for nothing is let go of, unless the worker is
+	// still drawing it
+	if (m_ahead_thread < 0)
+		m_ahead->Stop();
+	m_current->SetMode(mode);
+	return false;
 }
 
-void BSOD::SparcLinux(BView* view, int32 frame)
+// Lets go of what only the crash that ends needed; its artwork goes back
+// to the shared cache, which keeps it for later cycles.
+void BSOD::end_cycle()
 {
-	if (frame == 0)
-	{
-		view->SetViewColor(0,0,0);
-		view->Invalidate();
-	}
-	
-	if (frame > 1) 
-		return;		// Go away, kid.  You bother me.
-
-	int lines = 1;
-	const char *s;
-	
-	const char *linux_panic = (
-		"\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n"
-		"Unable to handle kernel paging request at virtual address f0d4a000\n"
-		"tsk->mm->context = 00000014\n"
-		"tsk->mm->pgd = f26b0000\n"
-		"              \\|/ ____ \\|/\n"
-		"              \"@'/ ,. \\`@\"\n"
-		"              /_| \\__/ |_\\\n"
-		"                 \\__U_/\n"
-		"gawk(22827): Oops\n"
-		"PSR: 044010c1 PC: f001c2cc NPC: f001c2d0 Y: 00000000\n"
-		"g0: 00001000 g1: fffffff7 g2: 04401086 g3: 0001eaa0\n"
-		"g4: 000207dc g5: f0130400 g6: f0d4a018 g7: 00000001\n"
-		"o0: 00000000 o1: f0d4a298 o2: 00000040 o3: f1380718\n"
-		"o4: f1380718 o5: 00000200 sp: f1b13f08 ret_pc: f001c2a0\n"
-		"l0: efffd880 l1: 00000001 l2: f0d4a230 l3: 00000014\n"
-		"l4: 0000ffff l5: f0131550 l6: f012c000 l7: f0130400\n"
-		"i0: f1b13fb0 i1: 00000001 i2: 00000002 i3: 0007c000\n"
-		"i4: f01457c0 i5: 00000004 i6: f1b13f70 i7: f0015360\n"
-		"Instruction DUMP:\n"
-	);
-	
-	for (s = linux_panic; *s; s++) if (*s == '\n') lines++;
-
-	BFont font(be_fixed_font);
-	font.SetSize(0.015625*view->Bounds().Width());
-	font.SetFlags(B_DISABLE_ANTIALIASING);
-	font.SetFace(B_BOLD_FACE);
-	font.SetSpacing(B_FIXED_SPACING);
-	view->SetFont(&font);
-
-	view->SetLowColor(0,0,0);			// black
-	view->SetHighColor(255,255,255);	// white
-
-	font_height info;
-	font.GetHeight(&info);
-
-	draw_string(view, &font,
-				10, (int)(view->Bounds().Height() - 
-					(lines * (info.ascent + info.descent + 1))),
-				10, 10,
-				linux_panic, 0);
+	m_current->Stop();
 }
 
-void BSOD::Amiga (BView *view, int32 frame)
+// Has the worker draw the crash the shuffle bag committed to next, for a
+// view the size of 'bounds'.  A worker still busy with a crash that came
+// too late is left to finish, the next crash being drawn in place then.
+// So is the next crash when no worker can run: drawing it here instead
+// would stall Draw() for as long as the worker would have taken.
+void BSOD::start_ahead(BRect bounds)
 {
-	if (frame == 0)
-	{
-		if (!m_bitmap)
-		{	
-			BRect bounds(0,0,amiga_hand_width-1,amiga_hand_height-1);
-			m_bitmap = new BBitmap(bounds, B_CMAP8);
-			int32 length = ((int32(bounds.right-bounds.left+1)+3)&0xFFFFFFFC)*int32(bounds.bottom-bounds.top+1);
-			m_bitmap->SetBits(amiga_hand_bits, length, 0, B_CMAP8);
-		}
-
-		view->SetViewColor(255,255,255);
-		view->Invalidate();
-		
-		SetTickSize(300000);
-	}
-
-	int height;
-
-	const char *string = (
-		"_Software failure.  Press left mouse button to continue.\n"
-		"_Guru Meditation #00000003.00C01570"
-	);
-
-	BFont font(be_fixed_font);
-	font.SetSize(0.01875 * view->Bounds().Width());
-	font.SetFlags(B_DISABLE_ANTIALIASING);
-	font.SetFace(B_BOLD_FACE);
-	font.SetSpacing(B_FIXED_SPACING);
-	view->SetFont(&font);
-	
-	font_height info;
-	font.GetHeight(&info);
-	height = (int)(info.ascent + info.descent) * 6;
+	if (m_ahead_thread >= 0)
+		return;
 
-	int pix_w = (int)((amiga_hand_width/640.0) * view->Bounds().Width());
-	int pix_h = (int)((amiga_hand_height/480.0) * view->Bounds().Height());
+	m_ahead->SetMode(m_modes.Peek());
+	m_ahead_bounds = bounds;
+	m_ahead_done = 0;
 
-	if (m_bitmap)
-	{		
-		int x = (int)((view->Bounds().Width() - pix_w) / 2);
-		int y = (int)((view->Bounds().Height() - pix_h) / 2);
-	
-		if (frame == 1) 
-		{
-			view->DrawBitmap(m_bitmap, m_bitmap->Bounds(), BRect(x, y, x + pix_w, y + pix_h));
-		}
-		if (frame == 4)
-		{
-			view->SetHighColor(255,255,255);
-			view->FillRect(BRect(x, y, x + pix_w, y + pix_h), B_SOLID_HIGH);
-			view->DrawBitmap(m_bitmap, m_bitmap->Bounds(),
-					BRect(x, y + height, x + pix_w, y + height + pix_h));
-		}
-		view->Sync();
-	}
+	m_ahead_thread = spawn_thread(ahead_thread, "BSOD next crash",
+								  B_NORMAL_PRIORITY, this);
+	if (m_ahead_thread >= 0 && resume_thread(m_ahead_thread) == B_OK)
+		return;
 
-	view->SetLowColor(0,0,0);			// black
-	view->SetHighColor(255,0,0);		// red
-	
-	if (frame == 4) 
-	{
-		view->FillRect(BRect(0,0,view->Bounds().Width(), height), B_SOLID_LOW);
-		draw_string(view, &font, 0, 0, (int)view->Bounds().Width(), height, string, 0);
-	}
-	if (frame > 3) 
-	{
-		pattern aPattern = (frame % 2 == 0) ? B_SOLID_HIGH : B_SOLID_LOW;
-		view->FillRect(BRect(0,0,view->Bounds().Width(), info.ascent), aPattern);
-		view->FillRect(BRect(0,0,info.ascent, height), aPattern);
-		view->FillRect(BRect(view->Bounds().Width()-info.ascent, 0, view->Bounds().Width(), height), aPattern);
-		view->FillRect(BRect(0,height-info.ascent,view->Bounds().Width(), height), aPattern);
-	}
+	if (m_ahead_thread >= 0)
+		kill_thread(m_ahead_thread);
+	m_ahead_thread = -1;
 }
 
-/* Atari ST, by Marcus Herbert <rhoenie@nobiscum.de>
-   Marcus had this to say:
-
-	Though I still have my Atari somewhere, I hardly remember
-	the meaning of the bombs. I think 9 bombs was "bus error" or
-	something like that.  And you often had a few bombs displayed
-	quickly and then the next few ones coming up step by step.
-	Perhaps somebody else can tell you more about it..  its just
-	a quick hack :-}
- */
-void BSOD::Atari(BView *view, int32 frame)
+// Reaps the worker once it is done, or waits for it if 'wait' is set.
+void BSOD::finish_ahead(bool wait)
 {
-	if (frame == 0)
-	{
-		if (!m_bitmap)
-		{	
-			BRect bounds(0,0,atari_width-1,atari_height-1);
-			m_bitmap = new BBitmap(bounds, B_CMAP8);
-			int32 length = ((int32(bounds.right-bounds.left+1)+3)&0xFFFFFFFC)*int32(bounds.bottom-bounds.top+1);
-			m_bitmap->SetBits(atari_bits, length, 0, B_CMAP8);
-		}
-
-		view->SetViewColor(255,255,255);
-		view->Invalidate();
-		
-		SetTickSize(100000);
-	}
-
-	if (frame > 10)
+	if (m_ahead_thread < 0 || (!wait && atomic_get(&m_ahead_done) == 0))
 		return;
 
-	int pix_w = (int)((atari_width/640.0) * view->Bounds().Width());
-	int pix_h = (int)((atari_height/480.0) * view->Bounds().Height());
-	
-	int offset = pix_w + 2;
-
-	int i, x, y;
+	status_t result;
+	wait_for_thread(m_ahead_thread, &result);
+	m_ahead_thread = -1;
+}
 
-	view->SetHighColor(0,0,0);
-	view->SetLowColor(255,255,255);
+// Draws the next crash ahead with m_ahead, which nothing else touches
+// until the worker is reaped; m_ahead_done tells Draw() it may be.
+int32 BSOD::ahead_thread(void *data)
+{
+	BSOD *saver = (BSOD *) data;
 
-	x = 5;
-	y = (int)(view->Bounds().Height() - (view->Bounds().Height() / 5));
-	
-	if (y < 0) y = 0;
-	
-	if (frame == 1)
+	bigtime_t start = system_time();
+	if (saver->m_ahead->DrawAhead(saver->m_ahead_bounds))
 	{
-		for (i = 0; i < 7; i++) 
-		{
-			view->DrawBitmap(m_bitmap, m_bitmap->Bounds(), 
-				 BRect((x + (i*offset)), y, (x + (i*offset)) + pix_w, y + pix_h));
-		}
+		saver->m_prerenders++;
+		saver->m_prerender_time += system_time() - start;
 	}
 
-	if (frame >= 7 && frame < 11)
-	{
-		SetTickSize(400000);
-		for (i = 7; i < frame; i++)
-			view->DrawBitmap(m_bitmap, m_bitmap->Bounds(), 
-				 BRect((x + (i*offset)), y, (x + (i*offset)) + pix_w, y + pix_h));
-	}
-	view->Sync();
+	atomic_add(&saver->m_ahead_done, 1);
+	return 0;
 }
 
-void BSOD::Mac(BView* view, int32 frame)
+// Counts a Draw() for the mode about to draw, and the time since the last
+// one for the mode that drew then.
+void BSOD::count_wakeup(bigtime_t now)
 {
-	if (frame == 0)
-	{
-		if (!m_bitmap)
-		{	
-			BRect bounds(0,0,mac_width-1,mac_height-1);
-			m_bitmap = new BBitmap(bounds, B_CMAP8);
-			int32 length = ((int32(bounds.right-bounds.left+1)+3)&0xFFFFFFFC)*int32(bounds.bottom-bounds.top+1);
-			m_bitmap->SetBits(mac_bits, length, 0, B_CMAP8);
-		}
-
-		view->SetViewColor(0,0,0);
-		view->Invalidate();	
-	}
-
-	if (frame > 1) 
-		return;		// Go away, kid.  You bother me.
+	if (m_wakeup_last > 0)
+		m_mode_time[m_wakeup_mode] += now - m_wakeup_last;
 
-	const char *string = (
-		"0 0 0 0 0 0 0 F\n"
-		"0 0 0 0 0 0 0 3"
-	);
-	
-	view->SetHighColor(187, 255, 255); // PaleTurquoise1
-	view->SetLowColor(0, 0, 0);
-
-	BFont font(be_fixed_font);
-	font.SetSize(0.015625 * view->Bounds().Width());
-	font.SetFlags(B_DISABLE_ANTIALIASING);
-	font.SetFace(B_BOLD_FACE);
-	font.SetSpacing(B_FIXED_SPACING);
-	view->SetFont(&font);
-	
-	font_height info;
-	font.GetHeight(&info);
-
-	int pix_w = (int)((mac_width/640.0) * view->Bounds().Width());
-	int pix_h = (int)((mac_height/480.0) * view->Bounds().Height());
-		
-	int x = (int)(view->Bounds().Width() - pix_w) / 2;
-    int y = (int)(((view->Bounds().Height() + pix_h) / 2) 
-    		- pix_h - (info.ascent + info.descent) * 2);
-	if (y < 0) y = 0;
-
-	view->DrawBitmap(m_bitmap, m_bitmap->Bounds(), BRect(x, y, x+pix_w, y+pix_h));
-
-	draw_string(view, &font, 0, 0, view->Bounds().Width(), 
-				view->Bounds().Height() + pix_h, string, 0);
+	m_wakeup_last = now;
+	m_wakeup_mode = m_current->Mode() % kModeCount;
+	m_wakeups[m_wakeup_mode]++;
 }
 
-void BSOD::MacsBug(BView* view, int32 frame)
+void BSOD::reset_wakeups()
 {
-	if (frame == 0)
+	for (int i = 0; i < kModeCount; i++)
 	{
-		view->SetViewColor(170,170,170);
-		view->Invalidate();
-		
-		SetTickSize(200000);
+		m_wakeups[i] = 0;
+		m_mode_time[i] = 0;
 	}
-
-	int char_width, line_height;
-	int col_right, row_top, row_bottom, page_right, page_bottom, body_top;
-	int xoff, yoff;
-
-	const char *left = (
-		"    SP     \n"
-		" 04EB0A58  \n"
-		"58 00010000\n"
-		"5C 00010000\n"
-		"   ........\n"
-		"60 00000000\n"
-		"64 000004EB\n"
-		"   ........\n"
-		"68 0000027F\n"
-		"6C 2D980035\n"
-		"   ....-..5\n"
-		"70 00000054\n"
-		"74 0173003E\n"
-		"   ...T.s.>\n"
-		"78 04EBDA76\n"
-		"7C 04EBDA8E\n"
-		"   .S.L.a.U\n"
-		"80 00000000\n"
-		"84 000004EB\n"
-		"   ........\n"
-		"88 00010000\n"
-		"8C 00010000\n"
-		"   ...{3..S\n"
-		"\n"
-		"\n"
-		" CurApName \n"
-		"  Finder   \n"
-		"\n"
-		" 32-bit VM \n"
-		"SR Smxnzvc0\n"
-		"D0 04EC0062\n"
-		"D1 00000053\n"
-		"D2 FFFF0100\n"
-		"D3 00010000\n"
-		"D4 00010000\n"
-		"D5 04EBDA76\n"
-		"D6 04EBDA8E\n"
-		"D7 00000001\n"
-		"\n"
-		"A0 04EBDA76\n"
-		"A1 04EBDA8E\n"
-		"A2 A0A00060\n"
-		"A3 027F2D98\n"
-		"A4 027F2E58\n"
-		"A5 04EC04F0\n"
-		"A6 04EB0A86\n"
-		"A7 04EB0A58"
-	);
-	
-	const char *bottom = (
-		"  _A09D\n"
-		"     +00884    40843714     #$0700,SR         "
-		"                  ; A973        | A973\n"
-		"     +00886    40843765     *+$0400           "
-		"                                | 4A1F\n"
-		"     +00888    40843718     $0004(A7),([0,A7[)"
-		"                  ; 04E8D0AE    | 66B8"
-	);
-
-/*
-	const char *body = (
-		"Bus Error at 4BF6D6CC\n"
-		"while reading word from 4BF6D6CC in User data space\n"
-		" Unable to access that address\n"
-		"  PC: 2A0DE3E6\n"
-		"  Frame Type: B008"
-	);
-*/
-	const char * body = (
-		"PowerPC unmapped memory exception at 003AFDAC "
-		"BowelsOfTheMemoryMgr+04F9C\n"
-		" Calling chain using A6/R1 links\n"
-		"  Back chain  ISA  Caller\n"
-		"  00000000    PPC  28C5353C  __start+00054\n"
-		"  24DB03C0    PPC  28B9258C  main+0039C\n"
-		"  24DB0350    PPC  28B9210C  MainEvent+00494\n"
-		"  24DB02B0    PPC  28B91B40  HandleEvent+00278\n"
-		"  24DB0250    PPC  28B83DAC  DoAppleEvent+00020\n"
-		"  24DB0210    PPC  FFD3E5D0  "
-		"AEProcessAppleEvent+00020\n"
-		"  24DB0132    68K  00589468\n"
-		"  24DAFF8C    68K  00589582\n"
-		"  24DAFF26    68K  00588F70\n"
-		"  24DAFEB3    PPC  00307098  "
-		"EmToNatEndMoveParams+00014\n"
-		"  24DAFE40    PPC  28B9D0B0  DoScript+001C4\n"
-		"  24DAFDD0    PPC  28B9C35C  RunScript+00390\n"
-		"  24DAFC60    PPC  28BA36D4  run_perl+000E0\n"
-		"  24DAFC10    PPC  28BC2904  perl_run+002CC\n"
-		"  24DAFA80    PPC  28C18490  Perl_runops+00068\n"
-		"  24DAFA30    PPC  28BE6CC0  Perl_pp_backtick+000FC\n"
-		"  24DAF9D0    PPC  28BA48B8  Perl_my_popen+00158\n"
-		"  24DAF980    PPC  28C5395C  sfclose+00378\n"
-		"  24DAF930    PPC  28BA568C  free+0000C\n"
-		"  24DAF8F0    PPC  28BA6254  pool_free+001D0\n"
-		"  24DAF8A0    PPC  FFD48F14  DisposePtr+00028\n"
-		"  24DAF7C9    PPC  00307098  "
-		"EmToNatEndMoveParams+00014\n"
-		"  24DAF780    PPC  003AA180  __DisposePtr+00010"
-	);
-
-	const char *s;
-	int body_lines = 1;
-
-	for (s = body; *s; s++) if (*s == '\n') body_lines++;
-
-	BFont font(be_fixed_font);
-
-	font.SetSize(0.0125 * view->Bounds().Width());
-
-	font.SetFlags(B_DISABLE_ANTIALIASING);
-	font.SetFace(B_BOLD_FACE);
-	font.SetSpacing(B_FIXED_SPACING);
-	view->SetFont(&font);
-	
-	font_height info;
-	font.GetHeight(&info);
-
-	char_width = (int)font.StringWidth("W") + 1;
-
-	line_height = (int)(info.ascent + info.descent + 1);
-
-	col_right = char_width * 12;
-	page_bottom = line_height * 47;
-
-	if (page_bottom > view->Bounds().Height()) 
-		page_bottom = (int)view->Bounds().Height();
-
-	row_bottom = page_bottom - line_height;
-	row_top = row_bottom - (line_height * 4);
-	page_right = col_right + (char_width * 88);
-	body_top = row_top - (line_height * body_lines);
-
-	page_bottom += 2;
-	row_bottom += 2;
-	body_top -= 4;
-
-	xoff = (int)(view->Bounds().Width() - page_right) / 2;
-	yoff = (int)(view->Bounds().Height() - page_bottom) / 2;
-	if (xoff < 0) xoff = 0;
-	if (yoff < 0) yoff = 0;
-
-	if (frame == 1)
-	{
-		view->SetHighColor(0,0,0);
-		view->SetLowColor(255,255,255);
-	
-		view->FillRect(BRect(xoff, yoff, xoff+page_right, yoff+page_bottom), B_SOLID_LOW);	
-	
-		draw_string(view, &font, xoff, yoff, 10, 10, left, 0);
-		draw_string(view, &font, xoff+col_right, yoff+row_top, 10, 10, bottom, 0);
-	
-		view->FillRect(BRect(xoff + col_right, yoff, 
-							 xoff + col_right + 2, yoff+page_bottom), 
-					   B_SOLID_HIGH);
-	
-		view->StrokeLine(BPoint(xoff+col_right, yoff+row_top), 
-						 BPoint(xoff+page_right, yoff+row_top),
-						 B_SOLID_HIGH);
-		view->StrokeLine(BPoint(xoff+col_right, yoff+row_bottom), 
-						 BPoint(xoff+page_right, yoff+row_bottom),
-						 B_SOLID_HIGH);
-						 
-		view->StrokeRect(BRect(xoff, yoff, xoff+page_right, yoff+page_bottom), B_SOLID_HIGH);
-	
-		if (body_top > 4)
-			body_top = 4;
-	
-		draw_string(view, &font, xoff + col_right + char_width, yoff + body_top, 10, 10, body, 500);
-	}
-
-	// blinking cursor
-	view->StrokeLine(BPoint(xoff+col_right+(char_width/2)+2, yoff+row_bottom+3), 
-					 BPoint(xoff+col_right+(char_width/2)+2, yoff+page_bottom-3),
-					 B_SOLID_HIGH);
-	view->Sync();
-
-	if (frame % 2 == 0)
-	{		
-		view->StrokeLine(BPoint(xoff+col_right+(char_width/2)+2, yoff+row_bottom+3), 
-						 BPoint(xoff+col_right+(char_width/2)+2, yoff+page_bottom-3),
-						 B_SOLID_LOW);
-		view->Sync();
-    }
+	m_wakeup_last = 0;
+	m_wakeup_mode = 0;
 }
 
 BSODConfigView::BSODConfigView(BRect frame, BSOD *s)
@@ -39,6 +39,10 @@
 #include <ScreenSaver.h>
 #include <Locker.h>
 
+#include "CrashRenderer.h"
+#include "CycleScheduler.h"
+#include "ShuffleBag.h"
+
 #define TYPE_CHANGED		'mTyp'
 #define INTERVAL_CHANGED	'mInv'
 
@@ -58,28 +62,79 @@ class BSOD : public BScreenSaver, public BLocker {
  private:
  	friend class BSODConfigView;
  
- 	void Windows(BView *view, bool win9x, int32 frame);
-	void SCO(BView *view, int32 frame);
-	void SparcLinux(BView* view, int32 frame);
-	void Amiga(BView* view, int32 frame);
-	void Atari(BView *view, int32 frame);
-	void Mac(BView *view, int32 frame);
-	void MacsBug(BView *view, int32 frame);
-
-	void draw_string (BView *view, BFont *font, int xoff, int yoff,
-					  int win_width, int win_height, 
-					  const char *string, int delay);
-
-	int m_type, m_method;
+	bool begin_cycle(BRect bounds);
+	void end_cycle();
+	void start_ahead(BRect bounds);
+	void finish_ahead(bool wait);
+	static int32 ahead_thread(void *data);
+
+	void count_wakeup(bigtime_t now);
+	void reset_wakeups();
+
+	enum { kModeCount = CrashRenderer::kModeCount };
+
+	int m_type;
+
+	// picks the mode of the random ones, committed a crash ahead so the
+	// random cycle can have it drawn kPrepareAhead before the switch if
+	// not earlier
+	enum { kPrepareAhead = 1000000 };
+	ShuffleBag m_modes;
+	bool m_prepared;
+
+	// The crash up is drawn by m_current.  The next one of the random
+	// cycle is drawn up to its first keyframe by m_ahead, on a worker
+	// thread that shares nothing with Draw() but the cap; it sets
+	// m_ahead_done when it returns, and the two trade places at the
+	// switch if it did by then, which takes a single blit.  Otherwise the
+	// crash is drawn in place and the worker is not waited for.
+	CrashRenderer m_renderers[2];
+	CrashRenderer *m_current;
+	CrashRenderer *m_ahead;
+	BRect m_ahead_bounds;
+	thread_id m_ahead_thread;
+	int32 m_ahead_done;
 	
-	// used by random
+	// Atari ST bombs, one per exception number
+	enum { kMaxBombs = 32 };
+	int32 m_bombs;
+
+	// used by random, m_interval in seconds
 	int32 m_interval;
-	time_t m_last_reset;
-	int32 m_starting_frame;	
+	CycleScheduler m_cycle;
 	
-	BBitmap *m_bitmap, *m_icon;
+	BBitmap *m_icon;
 	image_id m_image;
 	bool m_preview;	
+
+	// scaled images no mode holds are kept within m_asset_budget MB; the
+	// renderers hold no more than m_memory_cap MB together unless it is 0
+	int32 m_asset_budget;
+	int32 m_memory_cap;
+
+	// The tick is set for the next keyframe of the crash up that falls
+	// due, within these bounds.
+	static const bigtime_t kMinTick = 10000;
+	static const bigtime_t kIdleTick = 60000000;
+
+	// frame cost, reported by StopSaver() in debug builds
+	int32 m_draw_count;
+	bigtime_t m_draw_time, m_draw_worst;
+
+	// the worker's time, and how long the switches of the random cycle
+	// took from when the deadline was seen until the new crash was up,
+	// with [1] the ones drawn ahead
+	int32 m_prerenders;
+	bigtime_t m_prerender_time;
+	int32 m_transitions[2];
+	bigtime_t m_transition_time[2], m_transition_worst[2];
+
+	// Draw() calls per mode and the time each mode was up, the wakeups
+	// per second being what an idle crash should bring down
+	int32 m_wakeups[kModeCount];
+	bigtime_t m_mode_time[kModeCount];
+	bigtime_t m_wakeup_last;
+	int32 m_wakeup_mode;
 };
 
 class BSODConfigView : public BView 
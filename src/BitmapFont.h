@@ -0,0 +1,26 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Description of a pixel font bundled with the screensaver.  Glyphs are
+ * stored packed at 1 bit per pixel, most significant bit leftmost, each
+ * row padded to a whole byte; GlyphAtlas draws them at integer scales.
+ * VGA 8x16 (vga_8x16.h) is the only one bundled so far.
+ */
+
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <SupportDefs.h>
+
+#include "TextEncoding.h"
+
+struct bitmap_font {
+	const char *name;
+	int32 width, height;	// cell size in pixels
+	int32 ascent;			// rows above the baseline
+	uint8 first, last;		// characters covered, all others are blank
+	text_encoding encoding;	// what the characters are, single byte
+	const uint8 *bits;		// (last - first + 1) glyphs of 'height' rows
+};
+
+#endif // BITMAP_FONT_H
@@ -0,0 +1,1237 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * CrashRenderer: draws one crash at a time, with everything that takes
+ * of its own: the fonts and glyph atlases, the text screen, the artwork
+ * scaled from the shared cache, the batch the drawing goes through and
+ * what of the crash has been drawn so far.  Nothing of it is shared with
+ * another renderer, so the random cycle has one draw the next crash
+ * ahead on a worker thread while another draws the current one.
+ *
+ * The mode code is based on Jamie Zawinski's xscreensaver BSOD:
+ *
+ * xscreensaver, Copyright (c) 1998 Jamie Zawinski <jwz@jwz.org>
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#include <Bitmap.h>
+#include <OS.h>
+#include <View.h>
+
+#include "AssetCache.h"
+#include "CrashRenderer.h"
+#include "CrashScripts.h"
+#include "GlyphAtlas.h"
+#include "TextScreen.h"
+
+#include "vga_8x16.h"
+
+// what the keyframes of the crashes stand for
+enum {
+	kShowEvent,			// the crash screen comes up
+	kLineEvent,			// one more line of text
+	kBlinkEvent,		// a cursor or border changes colour
+	kMoveEvent,			// the Guru Meditation hand moves down
+	kBombEvent,			// one more bomb
+	kDotEvent,			// one more dot of the dump
+	kDumpDoneEvent,		// the dump is complete
+	kRebootEvent		// the reboot message
+};
+
+// What each crash draws with, by mode: its font at a scale of the view
+// width, a bundled pixel font or else a bold system font; the scripts
+// written in it; and its artwork, drawn once or, for the Atari bombs, a
+// row of them.  The modes take their fonts from here, and the next crash
+// of the random cycle is prepared from it.
+//
+// Only VGA 8x16 is bundled so far.  The Amiga (Topaz), SPARC (Sun
+// Gallant) and Mac (Monaco/Chicago) screens still draw with a bold
+// be_fixed_font through the font server, their fonts being deferred, see
+// the README; each of them takes a data header like vga_8x16.h and its
+// font here.
+struct mode_assets {
+	float font_scale;
+	const bitmap_font *font;
+	const crash_script *scripts[3];
+	const char *image;
+	bool image_row;
+};
+
+static const mode_assets kModeAssets[] = {
+	{ 0.021875, &vga_8x16, { &w95 }, NULL, false },
+	{ 0.015625, &vga_8x16, { &wnt }, NULL, false },
+	{ 0.015625, &vga_8x16, { &sco_panic_1, &sco_panic_3, &sco_panic_4 },
+	  NULL, false },
+	{ 0.015625, NULL, { &linux_panic }, NULL, false },
+	{ 0.01875, NULL, { &amiga_guru }, "amiga_hand", false },
+	{ 0, NULL, { NULL }, "atari", true },
+	{ 0.015625, NULL, { &mac_sad }, "mac", false },
+	{ 0.0125, NULL, { &macsbug_left, &macsbug_bottom, &macsbug_body }, NULL,
+	  false }
+};
+
+// the size artwork drawn for 640x480 is drawn at in the view
+static void art_size(BRect bounds, const packed_image &art, int *width,
+					 int *height)
+{
+	*width = (int)((art.width/640.0) * bounds.Width());
+	*height = (int)((art.height/480.0) * bounds.Height());
+}
+
+CrashRenderer::CrashRenderer()
+{
+	m_method = 0;
+	m_bombs = 10;
+
+	m_text_bitmap = NULL;
+	m_screen = new TextScreen(&m_script_glyphs);
+
+	m_shown = 0;
+	m_blinks = 0;
+	m_reveal_lines = 0;
+	m_strings = false;
+
+	m_dump_dots = 0;
+	m_dump_stage = kDumpRunning;
+
+	m_frame = NULL;
+	m_frame_view = NULL;
+	m_frame_drawn = false;
+
+	m_peer = NULL;
+	m_held = 0;
+}
+
+CrashRenderer::~CrashRenderer()
+{
+	Unset();
+	delete m_screen;
+}
+
+void CrashRenderer::SetArtwork(const char *path)
+{
+	m_artwork.SetTo(path);
+}
+
+void CrashRenderer::SetCap(size_t bytes, CrashRenderer *peer)
+{
+	m_ledger.SetCap(bytes);
+	m_peer = peer;
+}
+
+void CrashRenderer::SetMode(int32 mode)
+{
+	if (mode < 0 || mode >= kModeCount)
+		mode = 0;
+
+	m_method = mode;
+	m_frame_drawn = false;
+}
+
+void CrashRenderer::Draw(BView *view, bool start)
+{
+	m_ledger.SetMode(m_method);
+	m_timeline.Update();
+
+	m_batch.Begin(view);
+	draw_mode(view, start);
+	m_batch.End();
+
+	account();
+}
+
+bigtime_t CrashRenderer::UntilNext()
+{
+	m_timeline.Update();
+	return m_timeline.UntilNext();
+}
+
+void CrashRenderer::Stop()
+{
+	// back to the shared cache, which keeps them for later crashes
+	m_images.Clear();
+	m_timeline.Stop();
+
+	// an idle renderer holds nothing the size of the view, which would
+	// only count against the other one's cap
+	m_screen->Unset();
+	delete m_text_bitmap;
+	m_text_bitmap = NULL;
+
+	// deletes m_frame_view with it
+	delete m_frame;
+	m_frame = NULL;
+	m_frame_view = NULL;
+	m_frame_drawn = false;
+
+	account();
+}
+
+void CrashRenderer::Unset()
+{
+	Stop();
+
+	for (int i = 0; i < kModeCount; i++)
+		m_fonts[i].Invalidate();
+	for (int32 i = 0; i < m_atlases.CountItems(); i++)
+		delete (GlyphAtlas *) m_atlases.ItemAt(i);
+	m_atlases.MakeEmpty();
+	m_script_glyphs.Clear();
+	m_artwork.Unset();
+
+	account();
+	m_ledger.SetMode(-1);
+}
+
+bool CrashRenderer::DrawAhead(BRect bounds)
+{
+	// anything still held from a crash drawn ahead for nothing goes first
+	Stop();
+	m_ledger.SetMode(m_method);
+
+	if (reserve((size_t) (bounds.IntegerWidth() + 1)
+				* (bounds.IntegerHeight() + 1) * sizeof(uint32)))
+	{
+		m_frame = new BBitmap(bounds, B_RGB32, true);
+		if (m_frame->InitCheck() == B_OK)
+		{
+			m_frame_view = new BView(bounds, "BSOD next", B_FOLLOW_NONE,
+									 B_WILL_DRAW);
+			m_frame->AddChild(m_frame_view);
+		}
+		else
+		{
+			delete m_frame;
+			m_frame = NULL;
+		}
+	}
+
+	if (!m_frame || !m_frame->Lock())
+	{
+		prepare_mode(bounds);
+		account();
+		return false;
+	}
+
+	// none of the modes draws before its first keyframe
+	m_batch.Begin(m_frame_view);
+	draw_mode(m_frame_view, true);
+	m_batch.FillRect(bounds, m_frame_view->ViewColor());
+
+	bigtime_t first = m_timeline.UntilNext();
+	m_timeline.Seek(first != B_INFINITE_TIMEOUT ? first : 0);
+	draw_mode(m_frame_view, false);
+	m_batch.End();
+
+	m_frame->Unlock();
+	m_frame_drawn = true;
+	account();
+	return true;
+}
+
+bool CrashRenderer::DrawnAhead(BRect bounds) const
+{
+	return m_frame_drawn && m_frame->Bounds() == bounds;
+}
+
+void CrashRenderer::ShowAhead(BView *view)
+{
+	m_ledger.SetMode(m_method);
+	m_timeline.Resume();
+
+	// no Invalidate(), the frame covers all of the view
+	view->SetViewColor(m_frame_view->ViewColor());
+	m_batch.Begin(view);
+	m_batch.DrawBitmap(m_frame, m_frame->Bounds(), view->Bounds());
+	m_batch.End();
+
+	// drawn by now, and not needed again
+	delete m_frame;
+	m_frame = NULL;
+	m_frame_view = NULL;
+	m_frame_drawn = false;
+	account();
+}
+
+int32 CrashRenderer::FontHits() const
+{
+	int32 hits = 0;
+	for (int i = 0; i < kModeCount; i++)
+		hits += m_fonts[i].Hits();
+	return hits;
+}
+
+int32 CrashRenderer::FontMisses() const
+{
+	int32 misses = 0;
+	for (int i = 0; i < kModeCount; i++)
+		misses += m_fonts[i].Misses();
+	return misses;
+}
+
+void CrashRenderer::ResetStats()
+{
+	m_ledger.ResetStats();
+	m_batch.ResetStats();
+}
+
+void CrashRenderer::draw_mode(BView *view, bool start)
+{
+	switch (m_method)
+	{
+		case 0:
+			Windows(view, true, start);
+			break;
+		case 1:
+			Windows(view, false, start);
+			break;
+		case 2:
+			SCO(view, start);
+			break;
+		case 3:
+			SparcLinux(view, start);
+			break;
+		case 4:
+			Amiga(view, start);
+			break;
+		case 5:
+			Atari(view, start);
+			break;
+		case 6:
+			Mac(view, start);
+			break;
+		case 7:
+			MacsBug(view, start);
+			break;
+		default:
+			break;
+	}
+}
+
+GlyphAtlas *CrashRenderer::atlas_for(const BFont *font)
+{
+	for (int32 i = 0; i < m_atlases.CountItems(); i++)
+	{
+		GlyphAtlas *atlas = (GlyphAtlas *) m_atlases.ItemAt(i);
+		if (atlas->Matches(font))
+			return atlas;
+	}
+
+	GlyphAtlas *atlas = new GlyphAtlas(font);
+	if (atlas->InitCheck() != B_OK || !reserve(atlas->Bytes()))
+	{
+		delete atlas;
+		return NULL;
+	}
+
+	m_atlases.AddItem(atlas);
+	return atlas;
+}
+
+GlyphAtlas *CrashRenderer::atlas_for(const bitmap_font *font, int scale)
+{
+	for (int32 i = 0; i < m_atlases.CountItems(); i++)
+	{
+		GlyphAtlas *atlas = (GlyphAtlas *) m_atlases.ItemAt(i);
+		if (atlas->Matches(font, scale))
+			return atlas;
+	}
+
+	GlyphAtlas *atlas = new GlyphAtlas(font, scale);
+	if (atlas->InitCheck() != B_OK || !reserve(atlas->Bytes()))
+	{
+		delete atlas;
+		return NULL;
+	}
+
+	m_atlases.AddItem(atlas);
+	return atlas;
+}
+
+FontContext *CrashRenderer::font_context(BRect bounds, int32 mode)
+{
+	const mode_assets &assets = kModeAssets[mode];
+	FontContext *context = &m_fonts[mode];
+
+	if (assets.font)
+	{
+		if (!context->Validate(bounds, assets.font_scale, assets.font))
+			context->SetAtlas(atlas_for(assets.font, context->PixelScale()));
+	}
+	else if (!context->Validate(bounds, assets.font_scale, true))
+		context->SetAtlas(atlas_for(context->Font()));
+
+	return context;
+}
+
+TextScreen *CrashRenderer::text_screen(BView *view, FontContext *fonts, int columns, int rows)
+{
+	GlyphAtlas *atlas = fonts->Atlas();
+	if (!atlas)
+		return NULL;
+
+	// never more cells than fit into the view
+	int fit_columns = (view->Bounds().IntegerWidth() + 1) / atlas->CharWidth();
+	int fit_rows = (view->Bounds().IntegerHeight() + 1) / atlas->LineHeight();
+	if (columns > fit_columns) columns = fit_columns;
+	if (rows > fit_rows) rows = fit_rows;
+
+	// SetTo() would drop the old cells anyway, so they do not count
+	if (atlas != m_screen->Atlas() || columns != m_screen->Columns()
+		|| rows != m_screen->Rows())
+	{
+		m_screen->Unset();
+		if (!reserve(TextScreen::BytesFor(atlas, columns, rows)))
+			return NULL;
+	}
+
+	if (m_screen->SetTo(atlas, columns, rows) != B_OK)
+		return NULL;
+
+	return m_screen;
+}
+
+const BBitmap *CrashRenderer::scaled_image(const packed_image &image,
+										   int32 width, int32 height)
+{
+	return scaled_image(image, width, height, 1, width, make_color(0, 0, 0));
+}
+
+const BBitmap *CrashRenderer::scaled_image(const packed_image &image,
+										   int32 width, int32 height,
+										   int32 count, int32 step,
+										   rgb_color background)
+{
+	// only what comes on top of the size of the image held now
+	size_t bytes = (size_t) ((count - 1) * step + width) * height
+		* sizeof(uint32);
+	size_t held = m_images.Bytes(image);
+	if (bytes > held && !reserve(bytes - held))
+		return NULL;
+
+	return m_images.GetRow(image, width, height, count, step, background);
+}
+
+// Gets what a mode draws with ready ahead of its first Draw(): its font
+// and glyph atlas, its scripts decoded for the atlas, and its artwork
+// scaled to the view.  The artwork only goes into the shared cache,
+// where the mode finds it once it takes its own reference.
+void CrashRenderer::prepare_mode(BRect bounds)
+{
+	const mode_assets &assets = kModeAssets[m_method];
+	if (assets.font_scale > 0)
+	{
+		GlyphAtlas *atlas = font_context(bounds, m_method)->Atlas();
+		for (int i = 0; atlas && i < 3 && assets.scripts[i]; i++)
+			m_script_glyphs.Glyphs(*assets.scripts[i], atlas->Encoding());
+	}
+
+	const packed_image *art = assets.image ? m_artwork.Find(assets.image)
+		: NULL;
+	if (!art)
+		return;
+
+	// as the mode asks for it, see scaled_image()
+	int pix_w, pix_h;
+	art_size(bounds, *art, &pix_w, &pix_h);
+	int32 count = assets.image_row ? m_bombs : 1;
+	int32 step = assets.image_row ? pix_w + 2 : pix_w + 1;
+	rgb_color background = assets.image_row ? make_color(255,255,255)
+		: make_color(0,0,0);
+
+	AssetCache *shared = m_images.Shared();
+	const BBitmap *bitmap = shared->Get(*art, pix_w + 1, pix_h + 1, count,
+										step, background);
+	if (bitmap)
+		shared->Put(bitmap);
+}
+
+// Tells the ledger what is held now, for the mode drawing, and the peer
+// what this renderer holds in all.
+void CrashRenderer::account()
+{
+	size_t bitmaps = 0;
+	if (m_text_bitmap)
+		bitmaps += m_text_bitmap->BitsLength();
+	if (m_frame)
+		bitmaps += m_frame->BitsLength();
+	m_ledger.Set(MemoryLedger::kBitmaps, bitmaps);
+
+	m_ledger.Set(MemoryLedger::kArtwork, m_images.Bytes());
+
+	size_t glyphs = 0;
+	for (int32 i = 0; i < m_atlases.CountItems(); i++)
+		glyphs += ((GlyphAtlas *) m_atlases.ItemAt(i))->Bytes();
+	m_ledger.Set(MemoryLedger::kGlyphs, glyphs);
+
+	m_ledger.Set(MemoryLedger::kText, m_screen->Bytes()
+				 + m_script_glyphs.Bytes());
+
+	atomic_set64(&m_held, m_ledger.Current());
+}
+
+// Whether 'bytes' more can be allocated within the memory cap, with what
+// the peer holds, dropping what the mode drawing does not need first if
+// they cannot.  The peer is left alone, it may be drawing.  Nothing
+// refused here may blank the screen: the modes fall back to drawing
+// their text as strings when the text screen is refused.
+bool CrashRenderer::reserve(size_t bytes)
+{
+	size_t peer = m_peer ? (size_t) atomic_get64(&m_peer->m_held) : 0;
+
+	account();
+	if (m_ledger.Fits(peer + bytes))
+		return true;
+
+	trim();
+	account();
+	return m_ledger.Admit(peer + bytes);
+}
+
+// Frees what can be rebuilt and the mode drawing is not using: the glyph
+// atlases of other modes and the scratch bitmap for strings.
+void CrashRenderer::trim()
+{
+	GlyphAtlas *current = m_fonts[m_method % kModeCount].Atlas();
+	for (int i = 0; i < kModeCount; i++)
+	{
+		if (i != m_method % kModeCount)
+			m_fonts[i].Invalidate();
+	}
+
+	for (int32 i = m_atlases.CountItems() - 1; i >= 0; i--)
+	{
+		GlyphAtlas *atlas = (GlyphAtlas *) m_atlases.ItemAt(i);
+		if (atlas != current && atlas != m_screen->Atlas())
+		{
+			m_atlases.RemoveItem(i);
+			delete atlas;
+		}
+	}
+
+	if (m_text_bitmap && !m_batch.References(m_text_bitmap))
+	{
+		delete m_text_bitmap;
+		m_text_bitmap = NULL;
+	}
+}
+
+bool CrashRenderer::prepare_text_bitmap(int width, int height)
+{
+	if (width <= 0 || height <= 0)
+		return false;
+
+	if (m_text_bitmap)
+	{
+		BRect bounds = m_text_bitmap->Bounds();
+		if (bounds.IntegerWidth() + 1 >= width 
+			&& bounds.IntegerHeight() + 1 >= height)
+			return true;
+
+		width = max_c(width, bounds.IntegerWidth() + 1);
+		height = max_c(height, bounds.IntegerHeight() + 1);
+		delete m_text_bitmap;
+		m_text_bitmap = NULL;
+	}
+
+	if (!reserve((size_t) width * height * sizeof(uint32)))
+		return false;
+
+	m_text_bitmap = new BBitmap(BRect(0, 0, width - 1, height - 1), B_RGB32);
+	if (m_text_bitmap->InitCheck() != B_OK)
+	{
+		delete m_text_bitmap;
+		m_text_bitmap = NULL;
+		return false;
+	}
+	return true;
+}
+
+void CrashRenderer::draw_string (BView *view, FontContext *fonts, int xoff, int yoff,
+	 				    int win_width, int win_height, const crash_script &script,
+	 				    rgb_color foreground, rgb_color background,
+	 				    int max_lines)
+{
+	int x, y;
+	int width = script.columns, height = script.line_count;
+	int char_width, line_height;
+	
+	char_width = fonts->CharWidth();
+	line_height = fonts->LineHeight();
+
+	x = (win_width - (width * char_width)) / 2;
+	y = (win_height - (height * line_height)) / 2;
+
+	if (x < 0) x = 2;
+	if (y < 0) y = 2;
+
+	x += xoff;
+	y += yoff;
+
+	// the first lines only, where the whole block goes
+	if (max_lines >= 0 && max_lines < height)
+		height = max_lines;
+	if (height == 0)
+		return;
+
+	// Compose the text into an offscreen bitmap from the glyph atlas and
+	// hand it to the app_server in one go; the bitmap starts a pixel left
+	// of the text to leave room for the inverted '@' bar.
+	GlyphAtlas *atlas = fonts->Atlas();
+	int block_width = width * char_width + 2;
+
+	// the scratch bitmap may still be queued from an earlier string, and
+	// must be drawn before it is composed into again or replaced
+	if (m_batch.References(m_text_bitmap))
+		m_batch.Flush();
+
+	const char *glyphs = atlas
+		? m_script_glyphs.Glyphs(script, atlas->Encoding()) : NULL;
+	bool composed = glyphs && atlas->CharWidth() == char_width
+		&& atlas->LineHeight() == line_height
+		&& prepare_text_bitmap(block_width, height * line_height);
+	if (composed)
+		fill_bitmap_rect(m_text_bitmap, 0, 0, block_width - 1,
+						 height * line_height - 1, background);
+	else
+		view->SetFont(fonts->Font());
+
+	for (int i = 0; i < height; i++, y += line_height)
+	{
+		const script_line &line = script.lines[i];
+		int off = line.indent * char_width;
+
+		if (composed)
+		{
+			int top = i * line_height;
+
+			if (line.inverted)
+				fill_bitmap_rect(m_text_bitmap, off, top,
+								 off + 1 + line.length * char_width,
+								 top + line_height - 1, foreground);
+
+			atlas->Compose(m_text_bitmap, off + 1, top, glyphs + line.offset,
+						   line.length,
+						   line.inverted ? background : foreground,
+						   line.inverted ? foreground : background);
+			continue;
+		}
+
+		if (line.inverted)
+			m_batch.FillRect(BRect(x+off-1, y+1, 
+								   x+off+(line.length*char_width), y+fonts->Ascent()+1),
+							 foreground);
+
+		if (line.length > 0)
+			m_batch.DrawString(script.text + line.text_offset, line.text_length,
+							   BPoint(x+off, y+fonts->Ascent()),
+							   line.inverted ? background : foreground);
+	}
+
+	if (composed)
+	{
+		int top = y - height * line_height;
+		m_batch.DrawBitmap(m_text_bitmap,
+			BRect(0, 0, block_width - 1, height * line_height - 1),
+			BRect(x - 1, top, x + block_width - 2, y - 1));
+		m_batch.Fold(height);
+	}
+}
+
+void CrashRenderer::Windows(BView *view, bool win95, bool start)
+{
+	if (start)
+	{
+		(win95 ? view->SetViewColor(0,0,165) : view->SetViewColor(0,0,128));
+		view->Invalidate();
+
+		// the text a moment after the view colour; NT scrolls out its dump
+		// one line every 750 ms
+		static const keyframe keys[] = {
+			{ kShowEvent, 50, 0, 1 },
+			{ kLineEvent, 50, 750, kRepeatForever }
+		};
+		m_timeline.Start(keys, win95 ? 1 : 2);
+		m_timeline.SetCount(kLineEvent, wnt.line_count);
+		m_shown = 0;
+		m_reveal_lines = 0;
+		m_strings = false;
+	}
+
+	// nothing changes once all of it is out
+	if (m_shown > 0 && (win95 || m_reveal_lines == wnt.line_count))
+		return;
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+
+	TextScreen *screen = m_strings ? NULL
+		: text_screen(view, fonts, 80, win95 ? 25 : 50);
+	if (!m_timeline.Passed(kShowEvent))
+		return;
+
+	// Without a text screen the text is drawn as strings where the screen
+	// would have put it, the dump redrawn as it grows.
+	if (!screen)
+	{
+		m_strings = true;
+		if (win95)
+		{
+			draw_string(view, fonts, 0, 0, (int)view->Bounds().Width(),
+						(int)view->Bounds().Height(), w95,
+						make_color(255,255,255), make_color(0,0,165));
+			m_shown = 1;
+			return;
+		}
+
+		int32 lines = m_timeline.Count(kLineEvent);
+		if (m_shown == 0 || lines != m_reveal_lines)
+			draw_string(view, fonts, 0, 0, 0, 0, wnt,
+						make_color(192,192,192), make_color(0,0,128), lines);
+		m_shown = 1;
+		m_reveal_lines = lines;
+		return;
+	}
+
+	if (win95)
+	{
+		screen->SetColor(0, make_color(0,0,165));			// blue
+		screen->SetColor(1, make_color(255,255,255));		// white
+
+		screen->Clear(1, 0);
+		screen->WriteBlock(0, 0, screen->Columns(), screen->Rows(), w95, 1, 0);
+		screen->Invalidate();
+		screen->Flush(&m_batch, BPoint((view->Bounds().Width() - screen->Width()) / 2,
+								   (view->Bounds().Height() - screen->Height()) / 2));
+		m_shown = 1;
+	}
+	else
+	{
+		screen->SetColor(0, make_color(0,0,128));			// dark blue
+		screen->SetColor(1, make_color(192,192,192));		// white
+
+		if (m_shown == 0)
+		{
+			screen->Clear(1, 0);
+			screen->Invalidate();
+			m_shown = 1;
+		}
+
+		// However late the tick, this is bounded by the script: at most
+		// wnt.line_count lines of cell writes, of which only the lines
+		// new since the last tick change and go dirty, and one Flush().
+		// A tick that catches up on lines draws them all in that one go.
+		int32 lines = m_timeline.Count(kLineEvent);
+		if (lines == m_reveal_lines && !screen->IsDirty())
+			return;
+
+		m_reveal_lines = lines;
+		screen->WriteBlock(0, 0, 0, 0, wnt, 1, 0, lines);
+		screen->Flush(&m_batch, BPoint(2, 2));
+	}
+}
+
+void CrashRenderer::SCO(BView* view, bool start)
+{
+	if (start)
+	{
+		view->SetViewColor(0,0,0);
+		view->Invalidate();
+
+		// The dump starts with the panic message and puts out a dot for
+		// every kDumpPagesPerDot pages; the last two messages come 200
+		// and 800 ms after it is done.
+		static const int32 kDumpTime = kDumpPages * 1000 / kDumpPagesPerSecond;
+		static const int32 kDotTime = kDumpPagesPerDot * 1000
+			/ kDumpPagesPerSecond;
+		static const keyframe keys[] = {
+			{ kShowEvent, 100, 0, 1 },
+			{ kDotEvent, 100 + kDotTime, kDotTime,
+			  kDumpPages / kDumpPagesPerDot },
+			{ kDumpDoneEvent, 100 + kDumpTime + 200, 0, 1 },
+			{ kRebootEvent, 100 + kDumpTime + 800, 0, 1 }
+		};
+		m_timeline.Start(keys, sizeof(keys) / sizeof(keys[0]));
+		m_shown = 0;
+		m_dump_dots = 0;
+		m_dump_stage = kDumpRunning;
+		m_strings = false;
+	}
+
+	if (m_dump_stage == kDumpRebootShown)
+		return;
+
+	// rows taken by each part, which all end in a newline; the dots of
+	// the dump progress get a row of their own
+	const int lines_1 = sco_panic_1.line_count - 1;
+	const int lines_2 = 1;
+	const int lines_3 = sco_panic_3.line_count - 1;
+	const int lines_4 = sco_panic_4.line_count - 1;
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+
+	TextScreen *screen = m_strings ? NULL : text_screen(view, fonts, 80, 25);
+	if (!m_timeline.Passed(kShowEvent))
+		return;
+
+	rgb_color black = make_color(0,0,0);
+	rgb_color white = make_color(255,255,255);
+
+	// The screen is anchored to the bottom of the view, its last row
+	// blank.  Without one the text is drawn as strings into the same
+	// rows, counted from the bottom of the view.
+	int rows = screen ? screen->Rows() : 0;
+	int line_height = screen ? screen->Atlas()->LineHeight()
+		: fonts->LineHeight();
+	int bottom = (int)view->Bounds().Height();
+	BPoint origin(12, bottom - rows * line_height + 2);
+
+	if (!screen)
+	{
+		m_strings = true;
+		view->SetFont(fonts->Font());
+	}
+	else
+	{
+		screen->SetColor(0, black);
+		screen->SetColor(1, white);
+	}
+
+	if (m_shown == 0)
+	{
+		int row = rows - (lines_1 + lines_2 + lines_3 + lines_4 + 1);
+		if (screen)
+		{
+			screen->Clear(1, 0);
+			screen->WriteBlock(0, row, 0, 0, sco_panic_1, 1, 0);
+			screen->Invalidate();
+		}
+		else
+			draw_string(view, fonts, 10, bottom + row * line_height, 0, 0,
+						sco_panic_1, white, black);
+		m_shown = 1;
+	}
+
+	// each tick only writes the cells of the dots that fell due since
+	// the last one
+	int32 dots = m_timeline.Count(kDotEvent);
+	int dot_row = rows - (lines_2 + lines_3 + lines_4 + 1);
+	for (; m_dump_dots < dots; m_dump_dots++)
+	{
+		if (screen)
+			screen->Put(m_dump_dots, dot_row, '.', 1, 0);
+		else
+			m_batch.DrawString(".", 1,
+				BPoint(origin.x + m_dump_dots * fonts->CharWidth(),
+					   origin.y + dot_row * line_height + fonts->Ascent()),
+				white);
+	}
+
+	if (m_dump_stage == kDumpRunning && m_timeline.Passed(kDumpDoneEvent))
+	{
+		int row = rows - (lines_3 + lines_4 + 1);
+		if (screen)
+			screen->WriteBlock(0, row, 0, 0, sco_panic_3, 1, 0);
+		else
+			draw_string(view, fonts, 10, bottom + row * line_height, 0, 0,
+						sco_panic_3, white, black);
+		m_dump_stage = kDumpDoneShown;
+	}
+
+	if (m_dump_stage == kDumpDoneShown && m_timeline.Passed(kRebootEvent))
+	{
+		int row = rows - (lines_4 + 1);
+		if (screen)
+			screen->WriteBlock(0, row, 0, 0, sco_panic_4, 1, 0);
+		else
+			draw_string(view, fonts, 10, bottom + row * line_height, 0, 0,
+						sco_panic_4, white, black);
+		m_dump_stage = kDumpRebootShown;
+	}
+
+	if (screen)
+		screen->Flush(&m_batch, origin);
+}
+
+void CrashRenderer::SparcLinux(BView* view, bool start)
+{
+	if (start)
+	{
+		view->SetViewColor(0,0,0);
+		view->Invalidate();
+
+		static const keyframe keys[] = {
+			{ kShowEvent, 100, 0, 1 }
+		};
+		m_timeline.Start(keys, 1);
+		m_shown = 0;
+	}
+
+	if (m_shown > 0)
+		return;		// Go away, kid.  You bother me.
+
+	int lines = linux_panic.line_count;
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+
+	TextScreen *screen = text_screen(view, fonts, 80, lines);
+	if (!m_timeline.Passed(kShowEvent))
+		return;
+
+	// without a text screen, drawn as a string where the screen would go
+	if (!screen)
+	{
+		draw_string(view, fonts, 10,
+					(int)view->Bounds().Height() - lines * fonts->LineHeight(),
+					0, 0, linux_panic, make_color(255,255,255),
+					make_color(0,0,0));
+		m_shown = 1;
+		return;
+	}
+
+	screen->SetColor(0, make_color(0,0,0));			// black
+	screen->SetColor(1, make_color(255,255,255));	// white
+
+	screen->Clear(1, 0);
+	screen->WriteBlock(0, screen->Rows() - lines, 0, 0, linux_panic, 1, 0);
+	screen->Invalidate();
+	screen->Flush(&m_batch, BPoint(12, view->Bounds().Height() - screen->Height() + 2));
+	m_shown = 1;
+}
+
+void CrashRenderer::Amiga (BView *view, bool start)
+{
+	if (start)
+	{
+		view->SetViewColor(255,255,255);
+		view->Invalidate();
+
+		// the hand, then the Guru Meditation above it with its border
+		// blinking every 300 ms
+		static const keyframe keys[] = {
+			{ kShowEvent, 300, 0, 1 },
+			{ kMoveEvent, 1200, 0, 1 },
+			{ kBlinkEvent, 1200, 300, kRepeatForever }
+		};
+		m_timeline.Start(keys, sizeof(keys) / sizeof(keys[0]));
+		m_shown = 0;
+		m_blinks = 0;
+	}
+
+	// 1 once the hand is shown, 2 once it moved down
+	int32 step = m_timeline.Passed(kMoveEvent) ? 2
+		: m_timeline.Passed(kShowEvent) ? 1 : 0;
+	int32 blinks = m_timeline.Count(kBlinkEvent);
+	if (!start && step == m_shown && blinks == m_blinks)
+		return;
+
+	int height;
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+	float ascent = fonts->Ascent();
+	height = (int)(fonts->Ascent() + fonts->Descent()) * 6;
+
+	const packed_image *art = m_artwork.Find(kModeAssets[m_method].image);
+	int pix_w = 0, pix_h = 0;
+	if (art)
+		art_size(view->Bounds(), *art, &pix_w, &pix_h);
+
+	// drawn 1:1, the destination rectangles used to include their edges
+	const BBitmap *hand = art ? scaled_image(*art, pix_w + 1, pix_h + 1) : NULL;
+	if (hand)
+	{
+		int x = (int)((view->Bounds().Width() - pix_w) / 2);
+		int y = (int)((view->Bounds().Height() - pix_h) / 2);
+
+		if (step == 1 && m_shown < 1)
+		{
+			m_batch.DrawBitmap(hand, hand->Bounds(), hand->Bounds().OffsetToCopy(x, y));
+		}
+		if (step == 2 && m_shown < 2)
+		{
+			m_batch.FillRect(BRect(x, y, x + pix_w, y + pix_h), make_color(255,255,255));
+			m_batch.DrawBitmap(hand, hand->Bounds(),
+					hand->Bounds().OffsetToCopy(x, y + height));
+		}
+	}
+
+	rgb_color black = make_color(0,0,0);
+	rgb_color red = make_color(255,0,0);
+
+	if (step == 2 && m_shown < 2)
+	{
+		m_batch.FillRect(BRect(0,0,view->Bounds().Width(), height), black);
+		draw_string(view, fonts, 0, 0, (int)view->Bounds().Width(), height,
+					amiga_guru, red, black);
+	}
+	if (blinks != m_blinks)
+	{
+		rgb_color color = (blinks % 2 == 1) ? red : black;
+		m_batch.FillRect(BRect(0,0,view->Bounds().Width(), ascent), color);
+		m_batch.FillRect(BRect(0,0,ascent, height), color);
+		m_batch.FillRect(BRect(view->Bounds().Width()-ascent, 0, view->Bounds().Width(), height), color);
+		m_batch.FillRect(BRect(0,height-ascent,view->Bounds().Width(), height), color);
+	}
+
+	// a hand that could not be had is not retried
+	m_shown = step;
+	m_blinks = blinks;
+}
+
+/* Atari ST, by Marcus Herbert <rhoenie@nobiscum.de>
+   Marcus had this to say:
+
+	Though I still have my Atari somewhere, I hardly remember
+	the meaning of the bombs. I think 9 bombs was "bus error" or
+	something like that.  And you often had a few bombs displayed
+	quickly and then the next few ones coming up step by step.
+	Perhaps somebody else can tell you more about it..  its just
+	a quick hack :-}
+ */
+void CrashRenderer::Atari(BView *view, bool start)
+{
+	// the first seven bombs appear at once, then one every 400 ms
+	int32 burst = m_bombs < 7 ? m_bombs : 7;
+
+	if (start)
+	{
+		view->SetViewColor(255,255,255);
+		view->Invalidate();
+
+		static const keyframe keys[] = {
+			{ kShowEvent, 100, 0, 1 },
+			{ kBombEvent, 1100, 400, kRepeatForever }
+		};
+		m_timeline.Start(keys, 2);
+		m_timeline.SetCount(kBombEvent, m_bombs - burst);
+		m_shown = 0;
+	}
+
+	int32 bombs = m_timeline.Passed(kShowEvent)
+		? burst + m_timeline.Count(kBombEvent) : 0;
+	if (bombs == m_shown)
+		return;
+
+	const packed_image *art = m_artwork.Find(kModeAssets[m_method].image);
+	if (!art)
+		return;
+
+	int pix_w, pix_h;
+	art_size(view->Bounds(), *art, &pix_w, &pix_h);
+
+	int offset = pix_w + 2;
+
+	// the whole row is composed once, each step blits the new bombs
+	const BBitmap *row = scaled_image(*art, pix_w + 1, pix_h + 1, m_bombs,
+									  offset, make_color(255,255,255));
+	if (!row)
+		return;
+
+	int x, y;
+
+	x = 5;
+	y = (int)(view->Bounds().Height() - (view->Bounds().Height() / 5));
+
+	if (y < 0) y = 0;
+
+	BRect source(m_shown * offset, 0, (bombs - 1) * offset + pix_w, pix_h);
+	m_batch.DrawBitmap(row, source, source.OffsetByCopy(x, y));
+	m_shown = bombs;
+}
+
+void CrashRenderer::Mac(BView* view, bool start)
+{
+	if (start)
+	{
+		view->SetViewColor(0,0,0);
+		view->Invalidate();
+
+		static const keyframe keys[] = {
+			{ kShowEvent, 100, 0, 1 }
+		};
+		m_timeline.Start(keys, 1);
+		m_shown = 0;
+	}
+
+	if (m_shown > 0)
+		return;		// Go away, kid.  You bother me.
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+
+	const packed_image *art = m_artwork.Find(kModeAssets[m_method].image);
+	int pix_w = 0, pix_h = 0;
+	if (art)
+		art_size(view->Bounds(), *art, &pix_w, &pix_h);
+
+	int x = (int)(view->Bounds().Width() - pix_w) / 2;
+    int y = (int)(((view->Bounds().Height() + pix_h) / 2)
+    		- pix_h - (fonts->Ascent() + fonts->Descent()) * 2);
+	if (y < 0) y = 0;
+
+	// fetched right away, drawn once the view colour is up
+	const BBitmap *face = art ? scaled_image(*art, pix_w + 1, pix_h + 1) : NULL;
+	if (!m_timeline.Passed(kShowEvent))
+		return;
+
+	if (face)
+		m_batch.DrawBitmap(face, face->Bounds(), face->Bounds().OffsetToCopy(x, y));
+
+	draw_string(view, fonts, 0, 0, view->Bounds().Width(),
+				view->Bounds().Height() + pix_h, mac_sad,
+				make_color(187, 255, 255),		// PaleTurquoise1
+				make_color(0, 0, 0));
+	m_shown = 1;
+}
+
+void CrashRenderer::MacsBug(BView* view, bool start)
+{
+	if (start)
+	{
+		view->SetViewColor(170,170,170);
+		view->Invalidate();
+
+		// the call chain comes out one line every 500 ms, the cursor
+		// blinks every 200 ms
+		static const keyframe keys[] = {
+			{ kShowEvent, 200, 0, 1 },
+			{ kLineEvent, 200, 500, kRepeatForever },
+			{ kBlinkEvent, 200, 200, kRepeatForever }
+		};
+		m_timeline.Start(keys, sizeof(keys) / sizeof(keys[0]));
+		m_timeline.SetCount(kLineEvent, macsbug_body.line_count);
+		m_shown = 0;
+		m_blinks = 0;
+		m_reveal_lines = 0;
+		m_strings = false;
+	}
+
+	FontContext *fonts = font_context(view->Bounds(), m_method);
+
+	TextScreen *screen = m_strings ? NULL : text_screen(view, fonts, 100, 47);
+	if (!m_timeline.Passed(kShowEvent))
+		return;
+
+	// Without a text screen the text is drawn as strings into the cells
+	// the screen would have, as many as fit into the view.
+	int char_width, line_height, columns, rows;
+	if (screen)
+	{
+		char_width = screen->Atlas()->CharWidth();
+		line_height = screen->Atlas()->LineHeight();
+		columns = screen->Columns();
+		rows = screen->Rows();
+	}
+	else
+	{
+		m_strings = true;
+		view->SetFont(fonts->Font());
+
+		char_width = fonts->CharWidth();
+		line_height = fonts->LineHeight();
+		columns = min_c(100, (view->Bounds().IntegerWidth() + 1) / char_width);
+		rows = min_c(47, (view->Bounds().IntegerHeight() + 1) / line_height);
+	}
+	int width = columns * char_width;
+	int height = rows * line_height;
+
+	// the register column is 11 cells wide, followed by a rule; the
+	// command line with the cursor is the last row, the disassembly
+	// the four above it
+	int col_right = 12;
+	int row_bottom = rows - 1;
+	int row_top = row_bottom - 4;
+
+	int xoff = (int)(view->Bounds().Width() - width) / 2;
+	int yoff = (int)(view->Bounds().Height() - height) / 2;
+	if (xoff < 1) xoff = 1;
+	if (yoff < 1) yoff = 1;
+	BPoint origin(xoff, yoff);
+
+	rgb_color black = make_color(0,0,0);
+	rgb_color white = make_color(255,255,255);
+
+	if (m_shown == 0)
+	{
+		if (screen)
+		{
+			screen->SetColor(0, white);
+			screen->SetColor(1, black);
+
+			screen->Clear(1, 0);
+			screen->WriteBlock(0, 0, 0, 0, macsbug_left, 1, 0);
+			screen->WriteBlock(col_right, row_top, 0, 0, macsbug_bottom, 1, 0);
+			screen->Invalidate();
+			screen->Flush(&m_batch, origin);
+		}
+		else
+		{
+			m_batch.FillRect(BRect(xoff, yoff, xoff + width - 1,
+								   yoff + height - 1), white);
+			draw_string(view, fonts, xoff - 2, yoff - 2, 0, 0, macsbug_left,
+						black, white);
+			draw_string(view, fonts, xoff + col_right * char_width - 2,
+						yoff + row_top * line_height - 2, 0, 0,
+						macsbug_bottom, black, white);
+		}
+
+		// the rules lie in cells that never change afterwards
+		int right = xoff + width - 1;
+		int row_top_y = yoff + row_top * line_height - 1;
+		int row_bottom_y = yoff + row_bottom * line_height - 1;
+
+		m_batch.FillRect(BRect(xoff + col_right * char_width - 3, yoff,
+							   xoff + col_right * char_width - 1,
+							   yoff + height - 1), black);
+		m_batch.StrokeLine(BPoint(xoff + col_right * char_width, row_top_y),
+						   BPoint(right, row_top_y), black);
+		m_batch.StrokeLine(BPoint(xoff + col_right * char_width, row_bottom_y),
+						   BPoint(right, row_bottom_y), black);
+		m_batch.StrokeRect(BRect(xoff - 1, yoff - 1, right + 1,
+								 yoff + height), black);
+
+		m_shown = 1;
+	}
+
+	// at most macsbug_body.line_count lines of cell writes per tick, or
+	// one string block without a screen, whatever the tick caught up on;
+	// the one Flush() below puts up the lines that changed
+	int32 lines = m_timeline.Count(kLineEvent);
+	if (lines > m_reveal_lines)
+	{
+		if (screen)
+			screen->WriteBlock(col_right + 1, 0, 0, 0, macsbug_body, 1, 0,
+							   lines);
+		else
+			draw_string(view, fonts, xoff + (col_right + 1) * char_width - 2,
+						yoff - 2, 0, 0, macsbug_body, black, white, lines);
+		m_reveal_lines = lines;
+	}
+
+	// blinking cursor
+	int32 blinks = m_timeline.Count(kBlinkEvent);
+	if (blinks != m_blinks)
+	{
+		char cursor = (blinks % 2 == 1) ? '|' : ' ';
+		if (screen)
+			screen->Put(col_right, row_bottom, cursor, 1, 0);
+		else
+		{
+			int x = xoff + col_right * char_width;
+			int y = yoff + row_bottom * line_height;
+			m_batch.FillRect(BRect(x, y, x + char_width - 1,
+								   y + line_height - 1), white);
+			if (cursor == '|')
+				m_batch.DrawString("|", 1, BPoint(x, y + fonts->Ascent()),
+								   black);
+		}
+		m_blinks = blinks;
+	}
+	if (screen)
+		screen->Flush(&m_batch, origin);
+}
@@ -0,0 +1,180 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * CrashRenderer: draws one crash at a time, with everything that takes
+ * of its own: the fonts and glyph atlases, the text screen, the artwork
+ * scaled from the shared cache, the batch the drawing goes through and
+ * what of the crash has been drawn so far.  Nothing of it is shared with
+ * another renderer, so the random cycle has one draw the next crash
+ * ahead on a worker thread while another draws the current one.
+ *
+ * The mode code is based on Jamie Zawinski's xscreensaver BSOD:
+ *
+ * xscreensaver, Copyright (c) 1998 Jamie Zawinski <jwz@jwz.org>
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#ifndef CRASH_RENDERER_H
+#define CRASH_RENDERER_H
+
+#include <List.h>
+#include <Rect.h>
+
+#include "Artwork.h"
+#include "DrawBatch.h"
+#include "FontContext.h"
+#include "ImageCache.h"
+#include "MemoryLedger.h"
+#include "ScriptGlyphs.h"
+#include "Timeline.h"
+
+class BBitmap;
+class BView;
+class GlyphAtlas;
+class TextScreen;
+struct crash_script;
+struct bitmap_font;
+struct packed_image;
+
+class CrashRenderer {
+ public:
+	enum { kModeCount = 8 };
+
+	CrashRenderer();
+	~CrashRenderer();
+
+	// the add-on the artwork is read from once a mode needs it, and how
+	// many bombs the Atari shows
+	void SetArtwork(const char *path);
+	void SetBombs(int32 bombs) { m_bombs = bombs; }
+	// Bounds what this renderer and 'peer' hold together, 0 for no cap;
+	// each only ever frees its own.
+	void SetCap(size_t bytes, CrashRenderer *peer);
+
+	// the crash drawn, started over by the next Draw() with 'start' set
+	void SetMode(int32 mode);
+	int32 Mode() const { return m_method; }
+
+	// Draws what of the crash fell due into 'view'; 'start' is set for
+	// its first Draw().
+	void Draw(BView *view, bool start);
+	// until the crash has something more to draw, B_INFINITE_TIMEOUT if
+	// it is done changing
+	bigtime_t UntilNext();
+	// Lets go of what only the crash drawn needed; the fonts and glyph
+	// atlases are kept for the crashes to come.
+	void Stop();
+	// Frees everything, the fonts and glyph atlases too.
+	void Unset();
+
+	// Draws the crash as its first Draw() would, then as it stands at its
+	// first keyframe, into a frame of its own the size of 'bounds'; if
+	// that cannot be had, only gets its fonts and artwork ready.  Needs
+	// no view, so it may run on a thread of its own.
+	bool DrawAhead(BRect bounds);
+	// whether a frame for 'bounds' was drawn ahead and not shown yet
+	bool DrawnAhead(BRect bounds) const;
+	// Puts the frame drawn ahead up in 'view' with a single blit; the
+	// crash carries on from there.
+	void ShowAhead(BView *view);
+
+	// what it holds and drew, reported by the saver in debug builds
+	const MemoryLedger &Ledger() const { return m_ledger; }
+	const ImageCache &Images() const { return m_images; }
+	const DrawBatch &Batch() const { return m_batch; }
+	int32 FontHits() const;
+	int32 FontMisses() const;
+	void ResetStats();
+
+ private:
+	// 'start' is set for the first Draw() of a crash
+	void Windows(BView *view, bool win9x, bool start);
+	void SCO(BView *view, bool start);
+	void SparcLinux(BView* view, bool start);
+	void Amiga(BView* view, bool start);
+	void Atari(BView *view, bool start);
+	void Mac(BView *view, bool start);
+	void MacsBug(BView *view, bool start);
+
+	// at most 'max_lines' lines of 'script' if it is not negative
+	void draw_string (BView *view, FontContext *fonts, int xoff, int yoff,
+					  int win_width, int win_height,
+					  const crash_script &script, rgb_color foreground,
+					  rgb_color background, int max_lines = -1);
+	GlyphAtlas *atlas_for(const BFont *font);
+	GlyphAtlas *atlas_for(const bitmap_font *font, int scale);
+	FontContext *font_context(BRect bounds, int32 mode);
+	bool prepare_text_bitmap(int width, int height);
+	TextScreen *text_screen(BView *view, FontContext *fonts, int columns,
+							int rows);
+	const BBitmap *scaled_image(const packed_image &image, int32 width,
+								int32 height);
+	const BBitmap *scaled_image(const packed_image &image, int32 width,
+								int32 height, int32 count, int32 step,
+								rgb_color background);
+
+	void draw_mode(BView *view, bool start);
+	void prepare_mode(BRect bounds);
+
+	void account();
+	bool reserve(size_t bytes);
+	void trim();
+
+	int32 m_method;
+
+	// Atari ST bombs, one per exception number
+	int32 m_bombs;
+
+	// the artwork, read from the add-on's resources and scaled to the view
+	Artwork m_artwork;
+	ImageCache m_images;
+
+	// everything drawn in one Draw(), submitted with a single Sync()
+	DrawBatch m_batch;
+
+	// per mode font and metrics, rebuilt only when the view size changes
+	FontContext m_fonts[kModeCount];
+
+	// text is composed here from glyph atlases, one per font size, out of
+	// the crash scripts decoded for them
+	BList m_atlases;
+	ScriptGlyphs m_script_glyphs;
+	BBitmap *m_text_bitmap;
+	TextScreen *m_screen;
+
+	// The crash drawn is paced by its keyframes; what of it has been
+	// drawn so far is carried across Draw() calls.
+	Timeline m_timeline;
+	int32 m_shown;			// steps drawn, the mode's own count
+	int32 m_blinks;			// blinks of a cursor or border drawn
+	int32 m_reveal_lines;
+	// the text screen was refused, so the crash draws its text as strings
+	bool m_strings;
+
+	// SCO dump progress: 5023 pages, 63 pages per '.'
+	enum { kDumpPages = 5023, kDumpPagesPerDot = 63,
+		   kDumpPagesPerSecond = 630 };
+	enum { kDumpRunning, kDumpDoneShown, kDumpRebootShown };
+	int32 m_dump_dots;
+	int32 m_dump_stage;
+
+	// the frame drawn ahead, which its view draws into
+	BBitmap *m_frame;
+	BView *m_frame_view;
+	bool m_frame_drawn;
+
+	// What the renderer holds; m_held is its total, published for the
+	// peer it shares the cap with, which may read it from another thread.
+	MemoryLedger m_ledger;
+	CrashRenderer *m_peer;
+	int64 m_held;
+};
+
+#endif // CRASH_RENDERER_H
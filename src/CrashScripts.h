@@ -0,0 +1,239 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * The built-in crash texts.  Their line tables are computed at compile
+ * time, see ScriptLayout.h.
+ */
+
+#ifndef CRASH_SCRIPTS_H
+#define CRASH_SCRIPTS_H
+
+#include "ScriptLayout.h"
+
+// Microsoft Windows 9x
+CRASH_SCRIPT(w95,
+	"\n@ Windows \n\n"
+	"A fatal exception 0E has occured at 0028:C004D86F in VXD VFAT(01) +\n"
+	"0000B897.  The current application will be terminated.\n"
+	"\n"
+	"* Press any key to terminate the current application.\n"
+	"* Press CTRL+ALT+DELETE again to restart your computer.  You will\n"
+	"  lose any unsaved information in all applications.\n"
+	"\n"
+	"_Press any key to continue _"
+);
+
+/* from Jim Niemira <urmane@urmane.org> */
+CRASH_SCRIPT(wnt,
+	"*** STOP: 0x0000001E (0x80000003,0x80106fc0,0x8025ea21,0xfd6829e8)\n"
+	"Unhandled Kernel exception c0000047 from fa8418b4 (8025ea21,fd6829e8)\n"
+	"\n"
+	"Dll Base Date Stamp - Name             Dll Base Date Stamp - Name\n"
+	"80100000 2be154c9 - ntoskrnl.exe       80400000 2bc153b0 - hal.dll\n"
+	"80258000 2bd49628 - ncrc710.sys        8025c000 2bd49688 - SCSIPORT.SYS \n"
+	"80267000 2bd49683 - scsidisk.sys       802a6000 2bd496b9 - Fastfat.sys\n"
+	"fa800000 2bd49666 - Floppy.SYS         fa810000 2bd496db - Hpfs_Rec.SYS\n"
+	"fa820000 2bd49676 - Null.SYS           fa830000 2bd4965a - Beep.SYS\n"
+	"fa840000 2bdaab00 - i8042prt.SYS       fa850000 2bd5a020 - SERMOUSE.SYS\n"
+	"fa860000 2bd4966f - kbdclass.SYS       fa870000 2bd49671 - MOUCLASS.SYS\n"
+	"fa880000 2bd9c0be - Videoprt.SYS       fa890000 2bd49638 - NCC1701E.SYS\n"
+	"fa8a0000 2bd4a4ce - Vga.SYS            fa8b0000 2bd496d0 - Msfs.SYS\n"
+	"fa8c0000 2bd496c3 - Npfs.SYS           fa8e0000 2bd496c9 - Ntfs.SYS\n"
+	"fa940000 2bd496df - NDIS.SYS           fa930000 2bd49707 - wdlan.sys\n"
+	"fa970000 2bd49712 - TDI.SYS            fa950000 2bd5a7fb - nbf.sys\n"
+	"fa980000 2bd72406 - streams.sys        fa9b0000 2bd4975f - ubnb.sys\n"
+	"fa9c0000 2bd5bfd7 - usbser.sys         fa9d0000 2bd4971d - netbios.sys\n"
+	"fa9e0000 2bd49678 - Parallel.sys       fa9f0000 2bd4969f - serial.SYS\n"
+	"faa00000 2bd49739 - mup.sys            faa40000 2bd4971f - SMBTRSUP.SYS\n"
+	"faa10000 2bd6f2a2 - srv.sys            faa50000 2bd4971a - afd.sys\n"
+	"faa60000 2bd6fd80 - rdr.sys            faaa0000 2bd49735 - bowser.sys\n"
+	"\n"
+	"Address dword dump Dll Base                                      - Name\n"
+	"801afc20 80106fc0 80106fc0 00000000 00000000 80149905 : "
+	  "fa840000 - i8042prt.SYS\n"
+	"801afc24 80149905 80149905 ff8e6b8c 80129c2c ff8e6b94 : "
+	  "8025c000 - SCSIPORT.SYS\n"
+	"801afc2c 80129c2c 80129c2c ff8e6b94 00000000 ff8e6b94 : "
+	  "80100000 - ntoskrnl.exe\n"
+	"801afc34 801240f2 80124f02 ff8e6df4 ff8e6f60 ff8e6c58 : "
+	  "80100000 - ntoskrnl.exe\n"
+	"801afc54 80124f16 80124f16 ff8e6f60 ff8e6c3c 8015ac7e : "
+	  "80100000 - ntoskrnl.exe\n"
+	"801afc64 8015ac7e 8015ac7e ff8e6df4 ff8e6f60 ff8e6c58 : "
+	  "80100000 - ntoskrnl.exe\n"
+	"801afc70 80129bda 80129bda 00000000 80088000 80106fc0 : "
+	  "80100000 - ntoskrnl.exe\n"
+	"\n"
+	"Kernel Debugger Using: COM2 (Port 0x2f8, Baud Rate 19200)\n"
+	"Restart and set the recovery options in the system control panel\n"
+	"or the /CRASHDEBUG system start option. If this message reappears,\n"
+	"contact your system administrator or technical support group."
+);
+
+// SCO UNIX
+CRASH_SCRIPT(sco_panic_1,
+	"Unexpected trap in kernel mode:\n"
+	"\n"
+	"cr0 0x80010013     cr2  0x00000014     cr3 0x00000000  tlb  0x00000000\n"
+	"ss  0x00071054    uesp  0x00012055     efl 0x00080888  ipl  0x00000005\n"
+	"cs  0x00092585     eip  0x00544a4b     err 0x004d4a47  trap 0x0000000E\n"
+	"eax 0x0045474b     ecx  0x0042544b     edx 0x57687920  ebx  0x61726520\n"
+	"esp 0x796f7520     ebp  0x72656164     esi 0x696e6720  edi  0x74686973\n"
+	"ds  0x3f000000     es   0x43494c48     fs  0x43525343  gs   0x4f4d4b53\n"
+	"\n"
+	"PANIC: k_trap - kernel mode trap type 0x0000000E\n"
+	"Trying to dump 5023 pages to dumpdev hd (1/41), 63 pages per '.'\n"
+);
+
+CRASH_SCRIPT(sco_panic_3,
+	"5023 pages dumped\n"
+	"\n"
+	"\n"
+);
+
+CRASH_SCRIPT(sco_panic_4,
+	"**   Safe to Power Off   **\n"
+	"           - or -\n"
+	"** Press Any Key to Reboot **\n"
+);
+
+// SPARC Linux
+CRASH_SCRIPT(linux_panic,
+	"\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n"
+	"Unable to handle kernel paging request at virtual address f0d4a000\n"
+	"tsk->mm->context = 00000014\n"
+	"tsk->mm->pgd = f26b0000\n"
+	"              \\|/ ____ \\|/\n"
+	"              \"@'/ ,. \\`@\"\n"
+	"              /_| \\__/ |_\\\n"
+	"                 \\__U_/\n"
+	"gawk(22827): Oops\n"
+	"PSR: 044010c1 PC: f001c2cc NPC: f001c2d0 Y: 00000000\n"
+	"g0: 00001000 g1: fffffff7 g2: 04401086 g3: 0001eaa0\n"
+	"g4: 000207dc g5: f0130400 g6: f0d4a018 g7: 00000001\n"
+	"o0: 00000000 o1: f0d4a298 o2: 00000040 o3: f1380718\n"
+	"o4: f1380718 o5: 00000200 sp: f1b13f08 ret_pc: f001c2a0\n"
+	"l0: efffd880 l1: 00000001 l2: f0d4a230 l3: 00000014\n"
+	"l4: 0000ffff l5: f0131550 l6: f012c000 l7: f0130400\n"
+	"i0: f1b13fb0 i1: 00000001 i2: 00000002 i3: 0007c000\n"
+	"i4: f01457c0 i5: 00000004 i6: f1b13f70 i7: f0015360\n"
+	"Instruction DUMP:\n"
+);
+
+// Commodore-Amiga
+CRASH_SCRIPT(amiga_guru,
+	"_Software failure.  Press left mouse button to continue.\n"
+	"_Guru Meditation #00000003.00C01570"
+);
+
+// Apple Mac OS ("Sad Mac")
+CRASH_SCRIPT(mac_sad,
+	"0 0 0 0 0 0 0 F\n"
+	"0 0 0 0 0 0 0 3"
+);
+
+// Apple Mac OS (MacsBug)
+CRASH_SCRIPT(macsbug_left,
+	"    SP     \n"
+	" 04EB0A58  \n"
+	"58 00010000\n"
+	"5C 00010000\n"
+	"   ........\n"
+	"60 00000000\n"
+	"64 000004EB\n"
+	"   ........\n"
+	"68 0000027F\n"
+	"6C 2D980035\n"
+	"   ....-..5\n"
+	"70 00000054\n"
+	"74 0173003E\n"
+	"   ...T.s.>\n"
+	"78 04EBDA76\n"
+	"7C 04EBDA8E\n"
+	"   .S.L.a.U\n"
+	"80 00000000\n"
+	"84 000004EB\n"
+	"   ........\n"
+	"88 00010000\n"
+	"8C 00010000\n"
+	"   ...{3..S\n"
+	"\n"
+	"\n"
+	" CurApName \n"
+	"  Finder   \n"
+	"\n"
+	" 32-bit VM \n"
+	"SR Smxnzvc0\n"
+	"D0 04EC0062\n"
+	"D1 00000053\n"
+	"D2 FFFF0100\n"
+	"D3 00010000\n"
+	"D4 00010000\n"
+	"D5 04EBDA76\n"
+	"D6 04EBDA8E\n"
+	"D7 00000001\n"
+	"\n"
+	"A0 04EBDA76\n"
+	"A1 04EBDA8E\n"
+	"A2 A0A00060\n"
+	"A3 027F2D98\n"
+	"A4 027F2E58\n"
+	"A5 04EC04F0\n"
+	"A6 04EB0A86\n"
+	"A7 04EB0A58"
+);
+
+CRASH_SCRIPT(macsbug_bottom,
+	"  _A09D\n"
+	"     +00884    40843714     #$0700,SR         "
+	"                  ; A973        | A973\n"
+	"     +00886    40843765     *+$0400           "
+	"                                | 4A1F\n"
+	"     +00888    40843718     $0004(A7),([0,A7[)"
+	"                  ; 04E8D0AE    | 66B8"
+);
+
+/*
+CRASH_SCRIPT(macsbug_body,
+	"Bus Error at 4BF6D6CC\n"
+	"while reading word from 4BF6D6CC in User data space\n"
+	" Unable to access that address\n"
+	"  PC: 2A0DE3E6\n"
+	"  Frame Type: B008"
+);
+*/
+
+CRASH_SCRIPT(macsbug_body,
+	"PowerPC unmapped memory exception at 003AFDAC "
+	"BowelsOfTheMemoryMgr+04F9C\n"
+	" Calling chain using A6/R1 links\n"
+	"  Back chain  ISA  Caller\n"
+	"  00000000    PPC  28C5353C  __start+00054\n"
+	"  24DB03C0    PPC  28B9258C  main+0039C\n"
+	"  24DB0350    PPC  28B9210C  MainEvent+00494\n"
+	"  24DB02B0    PPC  28B91B40  HandleEvent+00278\n"
+	"  24DB0250    PPC  28B83DAC  DoAppleEvent+00020\n"
+	"  24DB0210    PPC  FFD3E5D0  "
+	"AEProcessAppleEvent+00020\n"
+	"  24DB0132    68K  00589468\n"
+	"  24DAFF8C    68K  00589582\n"
+	"  24DAFF26    68K  00588F70\n"
+	"  24DAFEB3    PPC  00307098  "
+	"EmToNatEndMoveParams+00014\n"
+	"  24DAFE40    PPC  28B9D0B0  DoScript+001C4\n"
+	"  24DAFDD0    PPC  28B9C35C  RunScript+00390\n"
+	"  24DAFC60    PPC  28BA36D4  run_perl+000E0\n"
+	"  24DAFC10    PPC  28BC2904  perl_run+002CC\n"
+	"  24DAFA80    PPC  28C18490  Perl_runops+00068\n"
+	"  24DAFA30    PPC  28BE6CC0  Perl_pp_backtick+000FC\n"
+	"  24DAF9D0    PPC  28BA48B8  Perl_my_popen+00158\n"
+	"  24DAF980    PPC  28C5395C  sfclose+00378\n"
+	"  24DAF930    PPC  28BA568C  free+0000C\n"
+	"  24DAF8F0    PPC  28BA6254  pool_free+001D0\n"
+	"  24DAF8A0    PPC  FFD48F14  DisposePtr+00028\n"
+	"  24DAF7C9    PPC  00307098  "
+	"EmToNatEndMoveParams+00014\n"
+	"  24DAF780    PPC  003AA180  __DisposePtr+00010"
+);
+
+#endif // CRASH_SCRIPTS_H
@@ -0,0 +1,81 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * CycleScheduler: the deadlines of the random cycle, on the monotonic
+ * microsecond clock of system_time().  Each cycle ends 'interval' after
+ * the deadline that began it, so late ticks do not add up over cycles;
+ * how late each boundary was actually seen is kept to tell the latency
+ * and jitter of the switches.
+ */
+
+#include <math.h>
+
+#include "CycleScheduler.h"
+
+CycleScheduler::CycleScheduler()
+{
+	m_interval = 0;
+	m_start = m_begun = m_deadline = 0;
+	ResetStats();
+}
+
+void CycleScheduler::Start(bigtime_t now, bigtime_t interval)
+{
+	m_interval = interval;
+	m_start = m_begun = now;
+	m_deadline = now + interval;
+}
+
+void CycleScheduler::SetInterval(bigtime_t interval)
+{
+	m_interval = interval;
+	m_deadline = m_start + interval;
+}
+
+bool CycleScheduler::Advance(bigtime_t now)
+{
+	if (now < m_deadline)
+		return false;
+
+	bigtime_t latency = now - m_deadline;
+	m_cycles++;
+	m_latency += latency;
+	m_latency_squares += (double) latency * latency;
+	if (latency > m_worst_latency)
+		m_worst_latency = latency;
+
+	// on the old deadline, unless a whole cycle was missed
+	m_start = m_deadline;
+	if (m_start + m_interval <= now)
+		m_start = now;
+	m_begun = now;
+	m_deadline = m_start + m_interval;
+	return true;
+}
+
+bigtime_t CycleScheduler::UntilDeadline(bigtime_t now) const
+{
+	return m_deadline > now ? m_deadline - now : 0;
+}
+
+bigtime_t CycleScheduler::AverageLatency() const
+{
+	return m_cycles > 0 ? m_latency / m_cycles : 0;
+}
+
+bigtime_t CycleScheduler::Jitter() const
+{
+	if (m_cycles == 0)
+		return 0;
+
+	double mean = (double) m_latency / m_cycles;
+	double variance = m_latency_squares / m_cycles - mean * mean;
+	return variance > 0 ? (bigtime_t) sqrt(variance) : 0;
+}
+
+void CycleScheduler::ResetStats()
+{
+	m_cycles = 0;
+	m_latency = m_worst_latency = 0;
+	m_latency_squares = 0;
+}
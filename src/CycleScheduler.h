@@ -0,0 +1,52 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * CycleScheduler: the deadlines of the random cycle, on the monotonic
+ * microsecond clock of system_time().  Each cycle ends 'interval' after
+ * the deadline that began it, so late ticks do not add up over cycles;
+ * how late each boundary was actually seen is kept to tell the latency
+ * and jitter of the switches.
+ */
+
+#ifndef CYCLE_SCHEDULER_H
+#define CYCLE_SCHEDULER_H
+
+#include <OS.h>
+
+class CycleScheduler {
+ public:
+	CycleScheduler();
+
+	// the first cycle begins at 'now'
+	void Start(bigtime_t now, bigtime_t interval);
+	// the current cycle then ends 'interval' after it began
+	void SetInterval(bigtime_t interval);
+
+	// Whether the current cycle is over at 'now'; if it is, the next one
+	// begins and the boundary is counted.
+	bool Advance(bigtime_t now);
+
+	bigtime_t UntilDeadline(bigtime_t now) const;
+	// how long the current cycle has been running
+	bigtime_t Elapsed(bigtime_t now) const { return now - m_begun; }
+
+	// boundaries passed, and how late they were seen
+	int32 Cycles() const { return m_cycles; }
+	bigtime_t AverageLatency() const;
+	bigtime_t WorstLatency() const { return m_worst_latency; }
+	// the standard deviation of the latency
+	bigtime_t Jitter() const;
+	void ResetStats();
+
+ private:
+	bigtime_t m_interval;
+	bigtime_t m_start;		// the deadline the current cycle began at
+	bigtime_t m_begun;		// when it actually began
+	bigtime_t m_deadline;
+
+	int32 m_cycles;
+	bigtime_t m_latency, m_worst_latency;
+	double m_latency_squares;
+};
+
+#endif // CYCLE_SCHEDULER_H
@@ -0,0 +1,173 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * DrawBatch: collects the drawing a crash mode does during one Draw()
+ * and submits it to the view in one go, skipping redundant colour
+ * changes and with a single Sync() at the end instead of one per
+ * string or bitmap.  Bitmaps and strings handed to it must stay
+ * unchanged until they are drawn, at End() or Flush().
+ */
+
+#include <View.h>
+
+#include "DrawBatch.h"
+
+DrawBatch::DrawBatch()
+{
+	m_view = NULL;
+	m_count = 0;
+	m_color_valid = false;
+	ResetStats();
+}
+
+void DrawBatch::ResetStats()
+{
+	m_frames = m_requests = m_calls = m_max_calls = 0;
+	m_frame_requests = m_frame_calls = 0;
+}
+
+void DrawBatch::Begin(BView *view)
+{
+	m_view = view;
+	m_count = 0;
+
+	// the mode may have changed the colour behind our back
+	m_color_valid = false;
+	m_frame_requests = m_frame_calls = 0;
+}
+
+void DrawBatch::End()
+{
+	bool drawn = m_count > 0 || m_frame_calls > 0;
+
+	submit();
+	if (drawn)
+	{
+		m_view->Sync();
+		m_frame_calls++;
+	}
+
+	// the estimate of add(): unbatched, every operation came with a
+	// colour change and a sync
+	m_frames++;
+	m_requests += m_frame_requests;
+	m_calls += m_frame_calls;
+	if (m_frame_calls > m_max_calls)
+		m_max_calls = m_frame_calls;
+
+	m_view = NULL;
+}
+
+DrawBatch::draw_op *DrawBatch::add(op_type type, rgb_color color)
+{
+	if (m_count == kMaxOps)
+		Flush();
+
+	m_frame_requests += 3;
+
+	draw_op *op = &m_ops[m_count++];
+	op->type = type;
+	op->color = color;
+	op->bitmap = NULL;
+	op->string = NULL;
+	op->length = 0;
+	return op;
+}
+
+void DrawBatch::FillRect(BRect rect, rgb_color color)
+{
+	add(FILL_RECT, color)->rect = rect;
+}
+
+void DrawBatch::StrokeRect(BRect rect, rgb_color color)
+{
+	add(STROKE_RECT, color)->rect = rect;
+}
+
+void DrawBatch::StrokeLine(BPoint from, BPoint to, rgb_color color)
+{
+	add(STROKE_LINE, color)->rect = BRect(from, to);
+}
+
+void DrawBatch::DrawBitmap(const BBitmap *bitmap, BRect source,
+						   BRect destination)
+{
+	rgb_color none = { 0, 0, 0, 0 };
+	draw_op *op = add(DRAW_BITMAP, none);
+	op->bitmap = bitmap;
+	op->source = source;
+	op->rect = destination;
+
+	// no colour change needed
+	m_frame_requests--;
+}
+
+void DrawBatch::DrawString(const char *string, int32 length, BPoint where,
+						   rgb_color color)
+{
+	draw_op *op = add(DRAW_STRING, color);
+	op->string = string;
+	op->length = length;
+	op->rect = BRect(where, where);
+}
+
+bool DrawBatch::References(const BBitmap *bitmap) const
+{
+	for (int32 i = 0; i < m_count; i++)
+		if (m_ops[i].bitmap == bitmap)
+			return true;
+	return false;
+}
+
+void DrawBatch::Flush()
+{
+	if (m_count == 0)
+		return;
+
+	submit();
+	m_view->Sync();
+	m_frame_calls++;
+}
+
+// Sends the queued operations without syncing, so they are not drawn yet
+// when it returns.
+void DrawBatch::submit()
+{
+	for (int32 i = 0; i < m_count; i++)
+	{
+		const draw_op &op = m_ops[i];
+
+		if (op.type != DRAW_BITMAP && (!m_color_valid
+			|| op.color.red != m_color.red || op.color.green != m_color.green
+			|| op.color.blue != m_color.blue))
+		{
+			m_view->SetHighColor(op.color);
+			m_color = op.color;
+			m_color_valid = true;
+			m_frame_calls++;
+		}
+
+		switch (op.type)
+		{
+			case FILL_RECT:
+				m_view->FillRect(op.rect, B_SOLID_HIGH);
+				break;
+			case STROKE_RECT:
+				m_view->StrokeRect(op.rect, B_SOLID_HIGH);
+				break;
+			case STROKE_LINE:
+				m_view->StrokeLine(op.rect.LeftTop(),
+					BPoint(op.rect.right, op.rect.bottom), B_SOLID_HIGH);
+				break;
+			case DRAW_BITMAP:
+				m_view->DrawBitmapAsync(op.bitmap, op.source, op.rect);
+				break;
+			case DRAW_STRING:
+				m_view->DrawString(op.string, op.length, op.rect.LeftTop());
+				break;
+		}
+		m_frame_calls++;
+	}
+
+	m_count = 0;
+}
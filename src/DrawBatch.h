@@ -0,0 +1,84 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * DrawBatch: collects the drawing a crash mode does during one Draw()
+ * and submits it to the view in one go, skipping redundant colour
+ * changes and with a single Sync() at the end instead of one per
+ * string or bitmap.  Bitmaps and strings handed to it must stay
+ * unchanged until they are drawn, at End() or Flush().
+ */
+
+#ifndef DRAW_BATCH_H
+#define DRAW_BATCH_H
+
+#include <GraphicsDefs.h>
+#include <Rect.h>
+
+class BBitmap;
+class BView;
+
+class DrawBatch {
+ public:
+	DrawBatch();
+
+	void Begin(BView *view);
+	void End();
+
+	void FillRect(BRect rect, rgb_color color);
+	void StrokeRect(BRect rect, rgb_color color);
+	void StrokeLine(BPoint from, BPoint to, rgb_color color);
+	void DrawBitmap(const BBitmap *bitmap, BRect source, BRect destination);
+	void DrawString(const char *string, int32 length, BPoint where,
+					rgb_color color);
+
+	// Accounts for drawing that was folded into a single operation, like
+	// the glyph runs composed into one bitmap, each of which used to be a
+	// call of its own.
+	void Fold(int32 requests) { m_frame_requests += requests; }
+
+	// Sends everything queued so far and waits until it is drawn, for a
+	// bitmap handed over that is about to change.
+	void Flush();
+	// whether 'bitmap' is queued and not yet drawn
+	bool References(const BBitmap *bitmap) const;
+
+	// App_server calls per frame as actually made, and Requests(), an
+	// estimate of what they would have been unbatched: not measured, but
+	// three for every operation (a colour change, the call and a sync),
+	// two for a bitmap, and one for every glyph run folded.
+	int32 Frames() const { return m_frames; }
+	int32 Requests() const { return m_requests; }
+	int32 Calls() const { return m_calls; }
+	int32 MaxCalls() const { return m_max_calls; }
+	void ResetStats();
+
+ private:
+	enum op_type { FILL_RECT, STROKE_RECT, STROKE_LINE, DRAW_BITMAP,
+				   DRAW_STRING };
+
+	struct draw_op {
+		op_type type;
+		BRect rect, source;
+		rgb_color color;
+		const BBitmap *bitmap;
+		const char *string;
+		int32 length;
+	};
+
+	enum { kMaxOps = 64 };
+
+	draw_op *add(op_type type, rgb_color color);
+	void submit();
+
+	BView *m_view;
+	draw_op m_ops[kMaxOps];
+	int32 m_count;
+
+	bool m_color_valid;
+	rgb_color m_color;
+
+	int32 m_frames, m_requests, m_calls, m_max_calls;
+	int32 m_frame_requests, m_frame_calls;
+};
+
+#endif // DRAW_BATCH_H
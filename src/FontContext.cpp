@@ -0,0 +1,110 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * FontContext: the font a crash mode draws with, configured for a view
+ * size, together with the metrics derived from it.  Draw() validates it
+ * against the view bounds each frame and only rebuilds it (and queries
+ * the font) when they change.
+ */
+
+#include "BitmapFont.h"
+#include "FontContext.h"
+
+FontContext::FontContext()
+{
+	m_valid = false;
+	m_width = m_height = m_scale = 0;
+	m_bold = false;
+	m_bitmap_font = NULL;
+	m_pixel_scale = 1;
+
+	m_char_width = m_line_height = 0;
+	m_ascent = m_descent = 0;
+	m_atlas = NULL;
+
+	m_hits = m_misses = 0;
+}
+
+bool FontContext::Validate(BRect bounds, float scale, bool bold)
+{
+	if (m_valid && m_width == bounds.Width() && m_height == bounds.Height()
+		&& m_scale == scale && m_bold == bold && !m_bitmap_font)
+	{
+		m_hits++;
+		return true;
+	}
+
+	m_misses++;
+
+	m_font = *be_fixed_font;
+	m_font.SetSize(scale * bounds.Width());
+	m_font.SetFlags(B_DISABLE_ANTIALIASING);
+	if (bold)
+	{
+		m_font.SetFace(B_BOLD_FACE);
+		m_font.SetSpacing(B_FIXED_SPACING);
+	}
+
+	// this assumes fixed-width fonts
+	m_char_width = (int) m_font.StringWidth("W");
+	font_height info;
+	m_font.GetHeight(&info);
+	m_ascent = info.ascent;
+	m_descent = info.descent;
+	m_line_height = (int) (info.ascent + info.descent + 1);
+
+	m_atlas = NULL;
+
+	m_width = bounds.Width();
+	m_height = bounds.Height();
+	m_scale = scale;
+	m_bold = bold;
+	m_bitmap_font = NULL;
+	m_pixel_scale = 1;
+	m_valid = true;
+	return false;
+}
+
+bool FontContext::Validate(BRect bounds, float scale, const bitmap_font *font)
+{
+	if (m_valid && m_width == bounds.Width() && m_height == bounds.Height()
+		&& m_scale == scale && m_bitmap_font == font)
+	{
+		m_hits++;
+		return true;
+	}
+
+	m_misses++;
+
+	int pixel_scale = (int) (scale * bounds.Width() / font->height + 0.5);
+	if (pixel_scale < 1)
+		pixel_scale = 1;
+
+	// the metrics come from the font itself; m_font is only a stand-in
+	// for the rare case that the glyphs cannot be drawn
+	m_char_width = font->width * pixel_scale;
+	m_line_height = font->height * pixel_scale;
+	m_ascent = font->ascent * pixel_scale;
+	m_descent = m_line_height - m_ascent;
+
+	m_font = *be_fixed_font;
+	m_font.SetSize(m_line_height);
+	m_font.SetFlags(B_DISABLE_ANTIALIASING);
+
+	m_atlas = NULL;
+
+	m_width = bounds.Width();
+	m_height = bounds.Height();
+	m_scale = scale;
+	m_bold = false;
+	m_bitmap_font = font;
+	m_pixel_scale = pixel_scale;
+	m_valid = true;
+	return false;
+}
+
+void FontContext::Invalidate()
+{
+	m_valid = false;
+	m_atlas = NULL;
+}
@@ -0,0 +1,62 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * FontContext: the font a crash mode draws with, configured for a view
+ * size, together with the metrics derived from it.  Draw() validates it
+ * against the view bounds each frame and only rebuilds it (and queries
+ * the font) when they change.
+ */
+
+#ifndef FONT_CONTEXT_H
+#define FONT_CONTEXT_H
+
+#include <Font.h>
+#include <Rect.h>
+
+class GlyphAtlas;
+struct bitmap_font;
+
+class FontContext {
+ public:
+	FontContext();
+
+	// Returns true if the cached font is valid for a view of this size,
+	// otherwise rebuilds it at 'scale' times the view width and returns
+	// false.  A bold context also uses fixed spacing.
+	bool Validate(BRect bounds, float scale, bool bold);
+	// The same for a bundled pixel font: it is drawn at the integer scale
+	// that comes closest to a font 'scale' times the view width, but at
+	// least at its native size.
+	bool Validate(BRect bounds, float scale, const bitmap_font *font);
+	void Invalidate();
+
+	const BFont *Font() const { return &m_font; }
+	const bitmap_font *BitmapFont() const { return m_bitmap_font; }
+	int PixelScale() const { return m_pixel_scale; }
+	int CharWidth() const { return m_char_width; }
+	int LineHeight() const { return m_line_height; }
+	float Ascent() const { return m_ascent; }
+	float Descent() const { return m_descent; }
+
+	GlyphAtlas *Atlas() const { return m_atlas; }
+	void SetAtlas(GlyphAtlas *atlas) { m_atlas = atlas; }
+
+	int32 Hits() const { return m_hits; }
+	int32 Misses() const { return m_misses; }
+
+ private:
+	bool m_valid;
+	float m_width, m_height, m_scale;
+	bool m_bold;
+	const bitmap_font *m_bitmap_font;
+	int m_pixel_scale;
+
+	BFont m_font;
+	int m_char_width, m_line_height;
+	float m_ascent, m_descent;
+	GlyphAtlas *m_atlas;
+
+	int32 m_hits, m_misses;
+};
+
+#endif // FONT_CONTEXT_H
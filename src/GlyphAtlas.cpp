@@ -0,0 +1,321 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * GlyphAtlas: a fixed-width font held as a 1 bit per pixel glyph table,
+ * so text can be composed into an offscreen bitmap without a round trip
+ * to the app_server for every string.  The table is either rasterized
+ * once from a BFont or taken from a bundled bitmap_font, which is drawn
+ * at an integer scale.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Bitmap.h>
+#include <View.h>
+
+#include "BitmapFont.h"
+#include "GlyphAtlas.h"
+#include "SpanExpander.h"
+
+// glyphs are rasterized 16 to a row, the printable characters of
+// Latin-1: 0x20 - 0x7e and 0xa0 - 0xff
+static const int kAtlasColumns = 16;
+static const int kFirstGlyph = 0x20;
+static const int kLastGlyph = 0xff;
+
+static inline bool is_printable(int c)
+{
+	return c <= 0x7e || c >= 0xa0;
+}
+
+static inline uint32 pack_rgb32(rgb_color color)
+{
+	// B_RGB32 is stored as B, G, R, A in memory on every host
+	uint8 bytes[4] = { color.blue, color.green, color.red, 255 };
+	uint32 pixel;
+	memcpy(&pixel, bytes, sizeof(pixel));
+	return pixel;
+}
+
+GlyphAtlas::GlyphAtlas(const BFont *font)
+{
+	m_size = font->Size();
+	m_face = font->Face();
+	m_flags = font->Flags();
+	m_bitmap_font = NULL;
+	m_scale = 1;
+	m_encoding = kEncodingLatin1;
+
+	m_char_width = m_line_height = m_ascent = 0;
+	m_glyph_width = m_glyph_height = 0;
+	m_glyph_bpr = 0;
+	m_glyphs = NULL;
+
+	m_status = rasterize(font);
+}
+
+GlyphAtlas::GlyphAtlas(const bitmap_font *font, int scale)
+{
+	m_size = 0;
+	m_face = 0;
+	m_flags = 0;
+	m_bitmap_font = font;
+	m_scale = scale;
+	m_encoding = font->encoding;
+
+	m_char_width = m_line_height = m_ascent = 0;
+	m_glyph_width = m_glyph_height = 0;
+	m_glyph_bpr = 0;
+	m_glyphs = NULL;
+
+	m_status = unpack(font);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+	free(m_glyphs);
+}
+
+size_t GlyphAtlas::Bytes() const
+{
+	return sizeof(*this) + (m_glyphs ? 256 * m_glyph_height * m_glyph_bpr : 0);
+}
+
+bool GlyphAtlas::Matches(const BFont *font) const
+{
+	return !m_bitmap_font && m_size == font->Size() && m_face == font->Face()
+		&& m_flags == font->Flags();
+}
+
+bool GlyphAtlas::Matches(const bitmap_font *font, int scale) const
+{
+	return m_bitmap_font == font && m_scale == scale;
+}
+
+status_t GlyphAtlas::rasterize(const BFont *font)
+{
+	// this assumes fixed-width fonts, same as draw_string()
+	m_char_width = (int) font->StringWidth("W");
+	font_height info;
+	font->GetHeight(&info);
+	m_line_height = (int) (info.ascent + info.descent + 1);
+	m_ascent = (int) info.ascent;
+	m_glyph_width = m_char_width;
+	m_glyph_height = m_line_height;
+
+	if (m_char_width <= 0 || m_line_height <= 0)
+		return B_BAD_VALUE;
+
+	m_glyph_bpr = (m_char_width + 7) / 8;
+	m_glyphs = (uint8 *) calloc(256 * m_line_height, m_glyph_bpr);
+	if (!m_glyphs)
+		return B_NO_MEMORY;
+
+	int rows = (kLastGlyph - kFirstGlyph + kAtlasColumns) / kAtlasColumns;
+	BRect bounds(0, 0, m_char_width * kAtlasColumns - 1, m_line_height * rows - 1);
+
+	BBitmap *bitmap = new BBitmap(bounds, B_RGB32, true);
+	if (bitmap->InitCheck() != B_OK)
+	{
+		delete bitmap;
+		return B_NO_MEMORY;
+	}
+
+	BView *view = new BView(bounds, "glyph atlas", B_FOLLOW_NONE, 0);
+	bitmap->AddChild(view);
+	bitmap->Lock();
+
+	view->SetFont(font);
+	view->SetHighColor(255,255,255);
+	view->SetLowColor(0,0,0);
+	view->FillRect(bounds, B_SOLID_LOW);
+
+	for (int c = kFirstGlyph; c <= kLastGlyph; c++)
+	{
+		if (!is_printable(c))
+			continue;
+
+		// DrawString() takes UTF-8, Latin-1 maps to U+0000 - U+00FF
+		int cell = c - kFirstGlyph;
+		char glyph[2] = { (char) c, 0 };
+		int length = 1;
+		if (c >= 0x80)
+		{
+			glyph[0] = 0xc0 | (c >> 6);
+			glyph[1] = 0x80 | (c & 0x3f);
+			length = 2;
+		}
+		view->DrawString(glyph, length,
+			BPoint((cell % kAtlasColumns) * m_char_width,
+				   (cell / kAtlasColumns) * m_line_height + info.ascent));
+	}
+	view->Sync();
+	bitmap->Unlock();
+
+	// threshold the rendered cells into the 1bpp glyph table
+	const uint8 *bits = (const uint8 *) bitmap->Bits();
+	int32 bpr = bitmap->BytesPerRow();
+
+	for (int c = kFirstGlyph; c <= kLastGlyph; c++)
+	{
+		if (!is_printable(c))
+			continue;
+
+		int cell = c - kFirstGlyph;
+		int left = (cell % kAtlasColumns) * m_char_width;
+		int top = (cell / kAtlasColumns) * m_line_height;
+		uint8 *glyph = m_glyphs + c * m_line_height * m_glyph_bpr;
+
+		for (int row = 0; row < m_line_height; row++)
+		{
+			const uint8 *src = bits + (top + row) * bpr + left * 4;
+			for (int col = 0; col < m_char_width; col++)
+			{
+				// green channel, the font is drawn white on black
+				if (src[col * 4 + 1] >= 128)
+					glyph[row * m_glyph_bpr + col / 8] |= 0x80 >> (col & 7);
+			}
+		}
+	}
+
+	delete bitmap;
+	return B_OK;
+}
+
+status_t GlyphAtlas::unpack(const bitmap_font *font)
+{
+	if (font->width <= 0 || font->height <= 0 || m_scale <= 0)
+		return B_BAD_VALUE;
+
+	m_glyph_width = font->width;
+	m_glyph_height = font->height;
+	m_glyph_bpr = (font->width + 7) / 8;
+	m_char_width = font->width * m_scale;
+	m_line_height = font->height * m_scale;
+	m_ascent = font->ascent * m_scale;
+
+	// same layout as the bundled data, just indexed by the character code
+	int32 glyph_size = m_glyph_height * m_glyph_bpr;
+	m_glyphs = (uint8 *) calloc(256, glyph_size);
+	if (!m_glyphs)
+		return B_NO_MEMORY;
+
+	memcpy(m_glyphs + font->first * glyph_size, font->bits,
+		   (font->last - font->first + 1) * glyph_size);
+	return B_OK;
+}
+
+void GlyphAtlas::pack_row(uint8 *bits, const char *string, int count,
+						  int row) const
+{
+	int32 glyph_size = m_glyph_height * m_glyph_bpr;
+	const uint8 *glyphs = m_glyphs + row * m_glyph_bpr;
+
+	if (m_glyph_width == 8)
+	{
+		for (int i = 0; i < count; i++)
+			bits[i] = glyphs[(uint8) string[i] * glyph_size];
+		return;
+	}
+
+	memset(bits, 0, (count * m_glyph_width + 7) / 8);
+	int bit = 0;
+	for (int i = 0; i < count; i++)
+	{
+		const uint8 *src = glyphs + (uint8) string[i] * glyph_size;
+		for (int col = 0; col < m_glyph_width; col++, bit++)
+		{
+			if (src[col / 8] & (0x80 >> (col & 7)))
+				bits[bit / 8] |= 0x80 >> (bit & 7);
+		}
+	}
+}
+
+void GlyphAtlas::Compose(BBitmap *target, int x, int y, const char *string,
+						 int length, rgb_color foreground,
+						 rgb_color background) const
+{
+	if (m_status != B_OK)
+		return;
+
+	uint32 fg = pack_rgb32(foreground);
+	uint32 bg = pack_rgb32(background);
+
+	uint8 *bits = (uint8 *) target->Bits();
+	int32 bpr = target->BytesPerRow();
+	int width = target->Bounds().IntegerWidth() + 1;
+	int height = target->Bounds().IntegerHeight() + 1;
+
+	// only the glyphs that are at least partly visible
+	int start = x < 0 ? -x / m_char_width : 0;
+	int end = (width - x + m_char_width - 1) / m_char_width;
+	if (end > length)
+		end = length;
+
+	// a glyph row of a whole run of characters is packed into one bit
+	// row, which is expanded in a single span
+	uint8 row_bits[512];
+	int chunk = (int) sizeof(row_bits) * 8 / m_glyph_width;
+
+	for (int i = start; i < end; i += chunk)
+	{
+		int count = end - i < chunk ? end - i : chunk;
+		int left = x + i * m_char_width;
+
+		// the visible part of these cells
+		int first = left < 0 ? -left : 0;
+		int last = count * m_char_width;
+		if (left + last > width)
+			last = width - left;
+
+		for (int row = 0; row < m_glyph_height; row++)
+		{
+			uint32 *expanded = NULL;
+
+			// expand the glyph row once, then repeat it m_scale times
+			for (int sy = 0; sy < m_scale; sy++)
+			{
+				int py = y + row * m_scale + sy;
+				if (py < 0 || py >= height)
+					continue;
+
+				uint32 *dst = (uint32 *) (bits + py * bpr) + left;
+				if (expanded)
+				{
+					memcpy(dst + first, expanded + first,
+						   (last - first) * sizeof(uint32));
+					continue;
+				}
+
+				pack_row(row_bits, string + i, count, row);
+				expand_span(dst + first, row_bits, first, last - first,
+							m_scale, fg, bg);
+				expanded = dst;
+			}
+		}
+	}
+}
+
+void fill_bitmap_rect(BBitmap *target, int left, int top, int right,
+					  int bottom, rgb_color color)
+{
+	uint32 pixel = pack_rgb32(color);
+
+	uint8 *bits = (uint8 *) target->Bits();
+	int32 bpr = target->BytesPerRow();
+	int width = target->Bounds().IntegerWidth() + 1;
+	int height = target->Bounds().IntegerHeight() + 1;
+
+	if (left < 0) left = 0;
+	if (top < 0) top = 0;
+	if (right >= width) right = width - 1;
+	if (bottom >= height) bottom = height - 1;
+
+	for (int y = top; y <= bottom; y++)
+	{
+		uint32 *dst = (uint32 *) (bits + y * bpr);
+		for (int x = left; x <= right; x++)
+			dst[x] = pixel;
+	}
+}
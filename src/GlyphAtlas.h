@@ -0,0 +1,70 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * GlyphAtlas: a fixed-width font held as a 1 bit per pixel glyph table,
+ * so text can be composed into an offscreen bitmap without a round trip
+ * to the app_server for every string.  The table is either rasterized
+ * once from a BFont or taken from a bundled bitmap_font, which is drawn
+ * at an integer scale.
+ */
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <Font.h>
+#include <GraphicsDefs.h>
+
+#include "TextEncoding.h"
+
+class BBitmap;
+struct bitmap_font;
+
+class GlyphAtlas {
+ public:
+	GlyphAtlas(const BFont *font);
+	GlyphAtlas(const bitmap_font *font, int scale);
+	~GlyphAtlas();
+
+	status_t InitCheck() const { return m_status; }
+	bool Matches(const BFont *font) const;
+	bool Matches(const bitmap_font *font, int scale) const;
+
+	int CharWidth() const { return m_char_width; }
+	int LineHeight() const { return m_line_height; }
+	int Ascent() const { return m_ascent; }
+	// what the glyph indices passed to Compose() are
+	text_encoding Encoding() const { return m_encoding; }
+	// the memory it holds
+	size_t Bytes() const;
+
+	// Blits 'length' glyphs of 'string' into a B_RGB32 bitmap with the
+	// top left corner of the first cell at (x, y), clipped to the bitmap.
+	void Compose(BBitmap *target, int x, int y, const char *string,
+				 int length, rgb_color foreground, rgb_color background) const;
+
+ private:
+	status_t rasterize(const BFont *font);
+	status_t unpack(const bitmap_font *font);
+	void pack_row(uint8 *bits, const char *string, int count, int row) const;
+
+	// the source of the glyphs, m_bitmap_font is NULL for a BFont
+	float m_size;
+	uint16 m_face;
+	uint32 m_flags;
+	const bitmap_font *m_bitmap_font;
+	int m_scale;
+	text_encoding m_encoding;
+
+	int m_char_width, m_line_height, m_ascent;	// scaled
+	int m_glyph_width, m_glyph_height;			// unscaled
+	int m_glyph_bpr;	// bytes per row of a single glyph
+	uint8 *m_glyphs;	// 256 glyphs of m_glyph_height rows each
+
+	status_t m_status;
+};
+
+// fills a rectangle of a B_RGB32 bitmap, clipped to its bounds
+void fill_bitmap_rect(BBitmap *target, int left, int top, int right,
+					  int bottom, rgb_color color);
+
+#endif // GLYPH_ATLAS_H
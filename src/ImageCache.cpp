@@ -0,0 +1,119 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ImageCache: the artwork a BSOD instance draws, each image scaled to
+ * the size a mode draws it at into a B_RGB32 bitmap, so it can be
+ * blitted 1:1 instead of having the app_server scale it on every
+ * DrawBitmap().  The bitmaps come from the process-wide AssetCache; an
+ * instance holds one size of each image and only goes back to the
+ * shared cache when it needs another one, e.g. after the resolution
+ * changed, or when it got a smooth copy of it.  A row of copies of an
+ * image can be composed into one bitmap as well, so drawing any run of
+ * them is a single blit.
+ */
+
+#include <Bitmap.h>
+
+#include "AssetCache.h"
+#include "ImageCache.h"
+
+ImageCache::ImageCache()
+{
+	m_shared = AssetCache::Acquire();
+	m_hits = m_misses = 0;
+}
+
+ImageCache::~ImageCache()
+{
+	Clear();
+	AssetCache::Release();
+}
+
+const BBitmap *ImageCache::Get(const packed_image &image, int32 width,
+							   int32 height)
+{
+	return GetRow(image, width, height, 1, width, make_color(0, 0, 0));
+}
+
+const BBitmap *ImageCache::GetRow(const packed_image &image, int32 width,
+								  int32 height, int32 count, int32 step,
+								  rgb_color background)
+{
+	entry *e = NULL;
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		e = (entry *) m_entries.ItemAt(i);
+		if (e->image == &image)
+			break;
+		e = NULL;
+	}
+
+	int32 generation = m_shared->Generation();
+	if (e && e->bitmap && e->width == width && e->height == height
+		&& e->count == count && (count == 1 || (e->step == step
+			&& e->background == background))
+		&& e->generation == generation)
+	{
+		m_hits++;
+		return e->bitmap;
+	}
+
+	if (!e)
+	{
+		e = new entry;
+		e->image = &image;
+		e->bitmap = NULL;
+		m_entries.AddItem(e);
+	}
+
+	// Fetched before the old one is put back, so an unchanged bitmap is
+	// not evicted in between.
+	m_misses++;
+	const BBitmap *bitmap = m_shared->Get(image, width, height, count, step,
+										  background);
+	if (e->bitmap)
+		m_shared->Put(e->bitmap);
+	e->bitmap = bitmap;
+	e->generation = generation;
+	e->width = width;
+	e->height = height;
+	e->count = count;
+	e->step = step;
+	e->background = background;
+	return e->bitmap;
+}
+
+size_t ImageCache::Bytes() const
+{
+	size_t bytes = 0;
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		const entry *e = (const entry *) m_entries.ItemAt(i);
+		if (e->bitmap)
+			bytes += e->bitmap->BitsLength();
+	}
+	return bytes;
+}
+
+size_t ImageCache::Bytes(const packed_image &image) const
+{
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		const entry *e = (const entry *) m_entries.ItemAt(i);
+		if (e->image == &image)
+			return e->bitmap ? e->bitmap->BitsLength() : 0;
+	}
+	return 0;
+}
+
+void ImageCache::Clear()
+{
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		entry *e = (entry *) m_entries.ItemAt(i);
+		if (e->bitmap)
+			m_shared->Put(e->bitmap);
+		delete e;
+	}
+	m_entries.MakeEmpty();
+}
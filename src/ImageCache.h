@@ -0,0 +1,65 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ImageCache: the artwork a BSOD instance draws, each image scaled to
+ * the size a mode draws it at into a B_RGB32 bitmap, so it can be
+ * blitted 1:1 instead of having the app_server scale it on every
+ * DrawBitmap().  The bitmaps come from the process-wide AssetCache; an
+ * instance holds one size of each image and only goes back to the
+ * shared cache when it needs another one, e.g. after the resolution
+ * changed, or when it got a smooth copy of it.  A row of copies of an
+ * image can be composed into one bitmap as well, so drawing any run of
+ * them is a single blit.
+ */
+
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include <GraphicsDefs.h>
+#include <List.h>
+#include <SupportDefs.h>
+
+class AssetCache;
+class BBitmap;
+struct packed_image;
+
+class ImageCache {
+ public:
+	ImageCache();
+	~ImageCache();
+
+	// The image scaled to width x height pixels, NULL if out of memory.
+	// It stays valid until the next Get() of the same image or Clear();
+	// that Get() may return a smoother one of the same size.
+	const BBitmap *Get(const packed_image &image, int32 width, int32 height);
+	// The same for 'count' copies side by side, the left edges 'step'
+	// pixels apart, with any gap between them filled with 'background'.
+	const BBitmap *GetRow(const packed_image &image, int32 width,
+						  int32 height, int32 count, int32 step,
+						  rgb_color background);
+	// hands the bitmaps back to the shared cache
+	void Clear();
+
+	// the pixels held, of all the images or just one
+	size_t Bytes() const;
+	size_t Bytes(const packed_image &image) const;
+
+	AssetCache *Shared() const { return m_shared; }
+	int32 Hits() const { return m_hits; }
+	int32 Misses() const { return m_misses; }
+
+ private:
+	struct entry {
+		const packed_image *image;
+		const BBitmap *bitmap;
+		int32 width, height, count, step;
+		rgb_color background;
+		int32 generation;	// of the shared cache when it was fetched
+	};
+
+	AssetCache *m_shared;
+	BList m_entries;
+	int32 m_hits, m_misses;
+};
+
+#endif // IMAGE_CACHE_H
@@ -0,0 +1,92 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * MemoryLedger: what a crash renderer holds, by kind of resource and by
+ * the mode that was drawing, with the current and peak totals.  The owners
+ * of the memory are asked for their sizes rather than reporting every
+ * allocation, so the ledger cannot drift from what is really held.  An
+ * optional hard cap is checked before anything new is allocated.
+ */
+
+#include "MemoryLedger.h"
+
+MemoryLedger::MemoryLedger()
+{
+	m_mode = -1;
+	for (int i = 0; i < kCategoryCount; i++)
+		m_current[i] = 0;
+	m_cap = 0;
+	ResetStats();
+}
+
+void MemoryLedger::SetMode(int32 mode)
+{
+	m_mode = mode >= 0 && mode < kMaxModes ? mode : -1;
+}
+
+void MemoryLedger::Set(category which, size_t bytes)
+{
+	m_current[which] = bytes;
+	if (bytes > m_category_peak[which])
+		m_category_peak[which] = bytes;
+
+	size_t total = Current();
+	if (total > m_peak)
+		m_peak = total;
+	if (m_mode >= 0 && total > m_mode_peak[m_mode])
+		m_mode_peak[m_mode] = total;
+}
+
+size_t MemoryLedger::Current() const
+{
+	size_t total = 0;
+	for (int i = 0; i < kCategoryCount; i++)
+		total += m_current[i];
+	return total;
+}
+
+size_t MemoryLedger::ModePeak(int32 mode) const
+{
+	return mode >= 0 && mode < kMaxModes ? m_mode_peak[mode] : 0;
+}
+
+bool MemoryLedger::Fits(size_t bytes) const
+{
+	return m_cap == 0 || Current() + bytes <= m_cap;
+}
+
+bool MemoryLedger::Admit(size_t bytes)
+{
+	if (Fits(bytes))
+		return true;
+
+	m_refusals++;
+	return false;
+}
+
+void MemoryLedger::ResetStats()
+{
+	for (int i = 0; i < kCategoryCount; i++)
+		m_category_peak[i] = m_current[i];
+	m_peak = Current();
+	for (int i = 0; i < kMaxModes; i++)
+		m_mode_peak[i] = 0;
+	m_refusals = 0;
+}
+
+const char *MemoryLedger::CategoryName(category which)
+{
+	switch (which)
+	{
+		case kBitmaps:
+			return "bitmaps";
+		case kArtwork:
+			return "artwork";
+		case kGlyphs:
+			return "glyphs";
+		case kText:
+			return "text";
+		default:
+			return "?";
+	}
+}
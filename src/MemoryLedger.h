@@ -0,0 +1,66 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * MemoryLedger: what a crash renderer holds, by kind of resource and by
+ * the mode that was drawing, with the current and peak totals.  The owners
+ * of the memory are asked for their sizes rather than reporting every
+ * allocation, so the ledger cannot drift from what is really held.  An
+ * optional hard cap is checked before anything new is allocated.
+ */
+
+#ifndef MEMORY_LEDGER_H
+#define MEMORY_LEDGER_H
+
+#include <SupportDefs.h>
+
+class MemoryLedger {
+ public:
+	enum category {
+		kBitmaps,	// offscreen bitmaps text is composed in, the frame ahead
+		kArtwork,	// scaled artwork held from the shared cache
+		kGlyphs,	// glyph atlases
+		kText,		// the text screen, decoded crash scripts
+		kCategoryCount
+	};
+	enum { kMaxModes = 8 };
+
+	MemoryLedger();
+
+	// the mode the following samples are charged to, -1 for none
+	void SetMode(int32 mode);
+	// what is held of a category right now
+	void Set(category which, size_t bytes);
+
+	size_t Current() const;
+	size_t Current(category which) const { return m_current[which]; }
+	size_t Peak() const { return m_peak; }
+	size_t Peak(category which) const { return m_category_peak[which]; }
+	// the most held while a mode was drawing
+	size_t ModePeak(int32 mode) const;
+
+	// 0 for no cap
+	void SetCap(size_t bytes) { m_cap = bytes; }
+	size_t Cap() const { return m_cap; }
+	// Whether 'bytes' more stay within the cap; Admit() counts it as
+	// refused if not.  A refusal only costs the owner its fast path: a
+	// mode refused its text screen still draws its text, as strings.
+	bool Fits(size_t bytes) const;
+	bool Admit(size_t bytes);
+	int32 Refusals() const { return m_refusals; }
+
+	// forgets the peaks and refusals, not what is held
+	void ResetStats();
+
+	static const char *CategoryName(category which);
+
+ private:
+	int32 m_mode;
+	size_t m_current[kCategoryCount];
+	size_t m_category_peak[kCategoryCount];
+	size_t m_peak;
+	size_t m_mode_peak[kMaxModes];
+	size_t m_cap;
+	int32 m_refusals;
+};
+
+#endif // MEMORY_LEDGER_H
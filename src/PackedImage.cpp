@@ -0,0 +1,168 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Artwork stored packed: each pixel is an index into a small palette of
+ * B_CMAP8 colours, at 1, 2, 4 or 8 bits per pixel, most significant bits
+ * leftmost and rows padded to a whole byte.  The rows may be compressed
+ * with PackBits.  Images are only decoded into a BBitmap when a mode
+ * first draws them.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Bitmap.h>
+#include <ByteOrder.h>
+#include <Debug.h>
+
+#include "PackedImage.h"
+
+// Expands PackBits data into exactly 'size' bytes; false if the data
+// ends early or overruns.
+static bool unpack_bits(const uint8 *data, int32 data_size, uint8 *out,
+						int32 size)
+{
+	const uint8 *end = data + data_size;
+	int32 done = 0;
+
+	while (done < size)
+	{
+		if (data >= end)
+			return false;
+
+		int8 header = (int8) *data++;
+		if (header >= 0)
+		{
+			// header + 1 literal bytes
+			int32 count = header + 1;
+			if (count > size - done || count > end - data)
+				return false;
+			memcpy(out + done, data, count);
+			data += count;
+			done += count;
+		}
+		else if (header != -128)
+		{
+			// the next byte, 1 - header times
+			int32 count = 1 - header;
+			if (count > size - done || data >= end)
+				return false;
+			memset(out + done, *data++, count);
+			done += count;
+		}
+	}
+
+	return true;
+}
+
+BBitmap *decode_packed_image(const packed_image &image)
+{
+	int32 row_bytes = (image.width * image.depth + 7) / 8;
+	int32 size = row_bytes * image.height;
+
+	const uint8 *packed = image.data;
+	uint8 *unpacked = NULL;
+	if (image.compressed)
+	{
+		unpacked = (uint8 *) malloc(size);
+		if (!unpacked)
+			return NULL;
+		if (!unpack_bits(image.data, image.data_size, unpacked, size))
+		{
+			free(unpacked);
+			return NULL;
+		}
+		packed = unpacked;
+	}
+	else if (image.data_size < size)
+		return NULL;
+
+	BBitmap *bitmap = new BBitmap(BRect(0, 0, image.width - 1,
+										image.height - 1), B_CMAP8);
+	if (bitmap->InitCheck() != B_OK)
+	{
+		delete bitmap;
+		free(unpacked);
+		return NULL;
+	}
+
+	uint8 *bits = (uint8 *) bitmap->Bits();
+	int32 bpr = bitmap->BytesPerRow();
+	int32 depth = image.depth;
+	uint8 mask = (1 << depth) - 1;
+
+	for (int32 y = 0; y < image.height; y++)
+	{
+		const uint8 *src = packed + y * row_bytes;
+		uint8 *dst = bits + y * bpr;
+
+		for (int32 x = 0; x < image.width; x++)
+		{
+			int32 bit = x * depth;
+			uint8 value = (src[bit / 8] >> (8 - depth - bit % 8)) & mask;
+			dst[x] = image.colors[value];
+		}
+	}
+
+	free(unpacked);
+
+	ASSERT(pixel_checksum(bits, bpr, image.width, image.height)
+		   == image.checksum);
+	return bitmap;
+}
+
+bool packed_image_from_blob(const void *blob, size_t size,
+							packed_image *image)
+{
+	packed_image_blob header;
+	if (size < sizeof(header))
+		return false;
+	memcpy(&header, blob, sizeof(header));
+
+	uint32 depth = B_LENDIAN_TO_HOST_INT32(header.depth);
+	if (memcmp(header.magic, "PKIM", 4) != 0
+		|| (depth != 1 && depth != 2 && depth != 4 && depth != 8))
+		return false;
+
+	const uint8 *colors = (const uint8 *) blob + sizeof(header);
+	const uint8 *data = colors + (1 << depth);
+	uint32 data_size = B_LENDIAN_TO_HOST_INT32(header.data_size);
+	if (sizeof(header) + (1 << depth) + (size_t) data_size > size)
+		return false;
+
+	// The decoder works in int32: the packed rows, and the B_CMAP8
+	// bitmap they are decoded into, have to fit.
+	uint64 width = B_LENDIAN_TO_HOST_INT32(header.width);
+	uint64 height = B_LENDIAN_TO_HOST_INT32(header.height);
+	uint64 row_bytes = (width * depth + 7) / 8;
+	if (width == 0 || height == 0 || width * depth + 7 > INT32_MAX
+		|| row_bytes * height > INT32_MAX || width * height > INT32_MAX)
+		return false;
+
+	image->width = width;
+	image->height = height;
+	image->depth = depth;
+	image->colors = colors;
+	image->compressed = B_LENDIAN_TO_HOST_INT32(header.compressed) != 0;
+	image->data = data;
+	image->data_size = data_size;
+	image->checksum = B_LENDIAN_TO_HOST_INT32(header.checksum);
+	return true;
+}
+
+uint32 pixel_checksum(const uint8 *bits, int32 bytes_per_row, int32 width,
+					  int32 height)
+{
+	uint32 hash = 2166136261U;
+	for (int32 y = 0; y < height; y++)
+	{
+		const uint8 *row = bits + y * bytes_per_row;
+		for (int32 x = 0; x < width; x++)
+		{
+			hash ^= row[x];
+			hash *= 16777619U;
+		}
+	}
+	return hash;
+}
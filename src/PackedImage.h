@@ -0,0 +1,55 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Artwork stored packed: each pixel is an index into a small palette of
+ * B_CMAP8 colours, at 1, 2, 4 or 8 bits per pixel, most significant bits
+ * leftmost and rows padded to a whole byte.  The rows may be compressed
+ * with PackBits.  Images are only decoded into a BBitmap when a mode
+ * first draws them.
+ */
+
+#ifndef PACKED_IMAGE_H
+#define PACKED_IMAGE_H
+
+#include <SupportDefs.h>
+
+class BBitmap;
+
+struct packed_image {
+	int32 width, height;
+	int32 depth;			// bits per pixel
+	const uint8 *colors;	// B_CMAP8 index of each of the 1 << depth values
+	bool compressed;		// PackBits, over all rows at once
+	const uint8 *data;
+	int32 data_size;
+	uint32 checksum;		// pixel_checksum() of the decoded pixels
+};
+
+// The same as a blob, as written by "packimage -b"; all fields are little
+// endian.  It is followed by the 1 << depth colours and data_size bytes of
+// data.
+struct packed_image_blob {
+	char magic[4];			// "PKIM"
+	uint32 width, height;
+	uint32 depth;
+	uint32 compressed;
+	uint32 data_size;
+	uint32 checksum;
+};
+
+// Points 'image' at the parts of a blob, which has to outlive it; false
+// if the blob is malformed.
+bool packed_image_from_blob(const void *blob, size_t size,
+							packed_image *image);
+
+// Decodes an image into a new B_CMAP8 bitmap, NULL if out of memory or
+// if the data is damaged.  Debug builds also check the pixels against
+// the checksum taken from the original artwork.
+BBitmap *decode_packed_image(const packed_image &image);
+
+// 32 bit FNV-1a over the visible pixels of B_CMAP8 rows, row padding
+// excluded.
+uint32 pixel_checksum(const uint8 *bits, int32 bytes_per_row, int32 width,
+					  int32 height);
+
+#endif // PACKED_IMAGE_H
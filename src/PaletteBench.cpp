@@ -0,0 +1,173 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Microbenchmark for the B_CMAP8 to B_RGB32 palette expander: converts a
+ * 3840x2160 screen of random B_CMAP8 pixels, rows padded to four bytes,
+ * with the scalar loop and with the variant picked for this machine, in
+ * cache and over the whole screen like SpanBench.  Then it scales the
+ * Amiga hand to the size it is drawn at on a 4K screen, once converting
+ * every target pixel through the palette as ImageCache used to, and once
+ * converting the source first and copying the scaled pixels.
+ *
+ * Build and run with "make PaletteBench && ./PaletteBench".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <OS.h>
+
+#include "PaletteExpander.h"
+
+static const int kWidth = 3838;
+static const int kHeight = 2160;
+static const int kSourceBPR = (kWidth + 3) & ~3;
+static const int kRounds = 20;
+
+// the Amiga hand, scaled the way Amiga() does for a 4K view
+static const int kHandWidth = 208;
+static const int kHandHeight = 257;
+static const int kHandBPR = (kHandWidth + 3) & ~3;
+static const int kScaledWidth = kHandWidth * 3840 / 640 + 1;
+static const int kScaledHeight = kHandHeight * 2160 / 480 + 1;
+
+typedef void (*expand_func)(uint32 *dst, const uint8 *src, int32 count,
+							const uint32 *palette);
+
+static bigtime_t time_screen(expand_func expand, const uint8 *src,
+							 uint32 *dst, const uint32 *palette,
+							 bool whole_screen)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		for (int y = 0; y < kHeight; y++)
+			expand(dst + (whole_screen ? y * kWidth : 0),
+				   src + y * kSourceBPR, kWidth, palette);
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+// nearest neighbour, sampling the middle of each target pixel
+static void scale_columns(int32 *columns)
+{
+	for (int x = 0; x < kScaledWidth; x++)
+		columns[x] = (2 * x + 1) * kHandWidth / (2 * kScaledWidth);
+}
+
+static bigtime_t time_scale(const uint8 *hand, uint32 *expanded,
+							uint32 *dst, const uint32 *palette,
+							const int32 *columns, bool convert_first)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		if (convert_first)
+		{
+			for (int y = 0; y < kHandHeight; y++)
+				expand_palette(expanded + y * kHandWidth, hand + y * kHandBPR,
+							   kHandWidth, palette);
+		}
+
+		for (int y = 0; y < kScaledHeight; y++)
+		{
+			int row = (2 * y + 1) * kHandHeight / (2 * kScaledHeight);
+			uint32 *out = dst + y * kScaledWidth;
+			if (convert_first)
+			{
+				const uint32 *in = expanded + row * kHandWidth;
+				for (int x = 0; x < kScaledWidth; x++)
+					out[x] = in[columns[x]];
+			}
+			else
+			{
+				const uint8 *in = hand + row * kHandBPR;
+				for (int x = 0; x < kScaledWidth; x++)
+					out[x] = palette[in[columns[x]]];
+			}
+		}
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+int main()
+{
+	uint8 *src = (uint8 *) malloc(kSourceBPR * kHeight);
+	uint32 *dst = (uint32 *) malloc(kWidth * kHeight * sizeof(uint32));
+	uint32 *check = (uint32 *) malloc(kWidth * sizeof(uint32));
+	uint8 *hand = (uint8 *) malloc(kHandBPR * kHandHeight);
+	uint32 *expanded = (uint32 *) malloc(kHandWidth * kHandHeight
+										 * sizeof(uint32));
+	int32 *columns = (int32 *) malloc(kScaledWidth * sizeof(int32));
+	if (!src || !dst || !check || !hand || !expanded || !columns)
+		return 1;
+
+	uint32 palette[256];
+	srand(1);
+	for (int i = 0; i < 256; i++)
+		palette[i] = rand() | 0xff000000;
+	for (int i = 0; i < kSourceBPR * kHeight; i++)
+		src[i] = rand();
+	for (int i = 0; i < kHandBPR * kHandHeight; i++)
+		hand[i] = rand() % 11;
+
+	// both have to agree before their timings mean anything
+	for (int y = 0; y < 16; y++)
+	{
+		int first = y * 3;
+		expand_palette_scalar(check, src + y * kSourceBPR + first,
+							  kWidth - first, palette);
+		expand_palette(dst, src + y * kSourceBPR + first, kWidth - first,
+					   palette);
+		if (memcmp(check, dst, (kWidth - first) * sizeof(uint32)) != 0)
+		{
+			printf("row %d: output differs from the scalar loop\n", y);
+			return 1;
+		}
+	}
+
+	printf("expand_palette variant: %s\n", expand_palette_variant());
+	printf("%dx%d, best of %d rounds\n\n", kWidth, kHeight, kRounds);
+
+	bigtime_t scalar = time_screen(expand_palette_scalar, src, dst, palette,
+								   false);
+	bigtime_t vector = time_screen(expand_palette, src, dst, palette, false);
+	printf("in cache:     scalar %6" B_PRIdBIGTIME " us  %s %6"
+		   B_PRIdBIGTIME " us  %5.1fx\n", scalar, expand_palette_variant(),
+		   vector, (double) scalar / vector);
+
+	scalar = time_screen(expand_palette_scalar, src, dst, palette, true);
+	vector = time_screen(expand_palette, src, dst, palette, true);
+	printf("whole screen: scalar %6" B_PRIdBIGTIME " us  %s %6"
+		   B_PRIdBIGTIME " us  %5.1fx\n", scalar, expand_palette_variant(),
+		   vector, (double) scalar / vector);
+
+	scale_columns(columns);
+	bigtime_t per_pixel = time_scale(hand, expanded, dst, palette, columns,
+									 false);
+	bigtime_t first = time_scale(hand, expanded, dst, palette, columns, true);
+	printf("\n%dx%d to %dx%d: per pixel conversion %" B_PRIdBIGTIME " us, "
+		   "converted first %" B_PRIdBIGTIME " us\n", kHandWidth, kHandHeight,
+		   kScaledWidth, kScaledHeight, per_pixel, first);
+
+	free(src);
+	free(dst);
+	free(check);
+	free(hand);
+	free(expanded);
+	free(columns);
+	return 0;
+}
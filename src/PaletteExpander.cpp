@@ -0,0 +1,132 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Expands rows of B_CMAP8 pixels into B_RGB32 through a 256 entry
+ * palette, for artwork that is converted once instead of on every blit.
+ * Uses an AVX2 gather or NEON table lookups where the compiler and the
+ * CPU support them, and a plain loop everywhere else.
+ */
+
+#include "PaletteExpander.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#	define PALETTE_EXPANDER_X86 1
+#	include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+// the 64 byte table lookups only exist on AArch64
+#	define PALETTE_EXPANDER_NEON 1
+#	include <arm_neon.h>
+#endif
+
+typedef void (*expand_func)(uint32 *dst, const uint8 *src, int32 count,
+							const uint32 *palette);
+
+void expand_palette_scalar(uint32 *dst, const uint8 *src, int32 count,
+						   const uint32 *palette)
+{
+	for (int32 i = 0; i < count; i++)
+		dst[i] = palette[src[i]];
+}
+
+// SSE2 has no gather and a 256 entry table is too large for byte
+// shuffles, so x86 machines without AVX2 use the scalar loop.
+
+#if PALETTE_EXPANDER_X86
+
+// Only this function is compiled for AVX2, it is picked at run time.
+__attribute__((target("avx2")))
+static void expand_palette_avx2(uint32 *dst, const uint8 *src, int32 count,
+								const uint32 *palette)
+{
+	int32 i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256i index = _mm256_cvtepu8_epi32(
+			_mm_loadl_epi64((const __m128i *) (src + i)));
+		_mm256_storeu_si256((__m256i *) (dst + i),
+			_mm256_i32gather_epi32((const int *) palette, index, 4));
+	}
+
+	expand_palette_scalar(dst + i, src + i, count - i, palette);
+}
+
+#endif // PALETTE_EXPANDER_X86
+
+#if PALETTE_EXPANDER_NEON
+
+// The palette is split into one 256 byte table per byte of a pixel;
+// each is looked up 64 entries at a time, and vst4q_u8() interleaves
+// the four results back into pixels.
+static void expand_palette_neon(uint32 *dst, const uint8 *src, int32 count,
+								const uint32 *palette)
+{
+	uint8 planes[4][256];
+	for (int i = 0; i < 256; i++)
+	{
+		const uint8 *bytes = (const uint8 *) (palette + i);
+		for (int c = 0; c < 4; c++)
+			planes[c][i] = bytes[c];
+	}
+
+	uint8x16_t quarter = vdupq_n_u8(64);
+	int32 i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		// lanes out of a table's range are left alone by vqtbx4q_u8()
+		uint8x16_t index[4];
+		index[0] = vld1q_u8(src + i);
+		for (int q = 1; q < 4; q++)
+			index[q] = vsubq_u8(index[q - 1], quarter);
+
+		uint8x16x4_t pixels;
+		for (int c = 0; c < 4; c++)
+		{
+			uint8x16_t bytes = vqtbl4q_u8(vld1q_u8_x4(planes[c]), index[0]);
+			for (int q = 1; q < 4; q++)
+			{
+				bytes = vqtbx4q_u8(bytes, vld1q_u8_x4(planes[c] + 64 * q),
+								   index[q]);
+			}
+			pixels.val[c] = bytes;
+		}
+		vst4q_u8((uint8 *) (dst + i), pixels);
+	}
+
+	expand_palette_scalar(dst + i, src + i, count - i, palette);
+}
+
+#endif // PALETTE_EXPANDER_NEON
+
+struct expand_variant {
+	expand_func func;
+	const char *name;
+};
+
+static expand_variant select_variant()
+{
+#if PALETTE_EXPANDER_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return { expand_palette_avx2, "AVX2" };
+#elif PALETTE_EXPANDER_NEON
+	return { expand_palette_neon, "NEON" };
+#endif
+	return { expand_palette_scalar, "scalar" };
+}
+
+static const expand_variant &active_variant()
+{
+	static const expand_variant variant = select_variant();
+	return variant;
+}
+
+void expand_palette(uint32 *dst, const uint8 *src, int32 count,
+					const uint32 *palette)
+{
+	active_variant().func(dst, src, count, palette);
+}
+
+const char *expand_palette_variant()
+{
+	return active_variant().name;
+}
@@ -0,0 +1,28 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Expands rows of B_CMAP8 pixels into B_RGB32 through a 256 entry
+ * palette, for artwork that is converted once instead of on every blit.
+ * Uses an AVX2 gather or NEON table lookups where the compiler and the
+ * CPU support them, and a plain loop everywhere else.
+ */
+
+#ifndef PALETTE_EXPANDER_H
+#define PALETTE_EXPANDER_H
+
+#include <SupportDefs.h>
+
+// Writes 'count' pixels to 'dst', palette[src[i]] for each of the first
+// 'count' bytes of 'src'; the palette entries are B_RGB32 pixels as laid
+// out in memory.
+void expand_palette(uint32 *dst, const uint8 *src, int32 count,
+					const uint32 *palette);
+
+// the reference loop, on every machine
+void expand_palette_scalar(uint32 *dst, const uint8 *src, int32 count,
+						   const uint32 *palette);
+
+// the name of the variant expand_palette() picked for this machine
+const char *expand_palette_variant();
+
+#endif // PALETTE_EXPANDER_H
@@ -0,0 +1,219 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Scale2x and Scale3x, the edge-directed pixel art scalers of AdvanceMAME:
+ * each pixel becomes a 2x2 or 3x3 block that takes the colour of a
+ * neighbour where two of its neighbours meet along a diagonal edge, so
+ * slopes stay sharp instead of turning into steps (plain stretching) or
+ * going soft (filtering).  Passes chain to 4x, 6x, 8x, 9x and so on.  The
+ * rows are cut into bands that are scaled on several threads at once.
+ */
+
+#include <OS.h>
+
+#include "PixelScaler.h"
+
+static const int32 kMaxThreads = 16;
+
+// a band of rows for one thread
+struct band {
+	uint32 *dst;
+	int32 dst_bpr;
+	const uint32 *src;
+	int32 src_bpr;
+	int32 width, height, factor;
+	int32 first_row, last_row;
+};
+
+// One output row block per source row, from the source row and the ones
+// above and below it; the image edge repeats outwards.  Naming the 3x3
+// neighbourhood
+//
+//	A B C
+//	D E F
+//	G H I
+//
+// a corner of E's block takes the colour of the two sides meeting there
+// if they are equal and the edge they form does not continue past E.
+static void scale2x_row(uint32 *out0, uint32 *out1, const uint32 *above,
+						const uint32 *row, const uint32 *below, int32 width)
+{
+	for (int32 x = 0; x < width; x++)
+	{
+		uint32 B = above[x], H = below[x], E = row[x];
+		uint32 D = row[x > 0 ? x - 1 : x];
+		uint32 F = row[x < width - 1 ? x + 1 : x];
+
+		if (B != H && D != F)
+		{
+			out0[2 * x] = D == B ? D : E;
+			out0[2 * x + 1] = B == F ? F : E;
+			out1[2 * x] = D == H ? D : E;
+			out1[2 * x + 1] = H == F ? F : E;
+		}
+		else
+		{
+			out0[2 * x] = out0[2 * x + 1] = E;
+			out1[2 * x] = out1[2 * x + 1] = E;
+		}
+	}
+}
+
+static void scale3x_row(uint32 *out0, uint32 *out1, uint32 *out2,
+						const uint32 *above, const uint32 *row,
+						const uint32 *below, int32 width)
+{
+	for (int32 x = 0; x < width; x++)
+	{
+		int32 left = x > 0 ? x - 1 : x;
+		int32 right = x < width - 1 ? x + 1 : x;
+		uint32 A = above[left], B = above[x], C = above[right];
+		uint32 D = row[left], E = row[x], F = row[right];
+		uint32 G = below[left], H = below[x], I = below[right];
+
+		if (B != H && D != F)
+		{
+			out0[3 * x] = D == B ? D : E;
+			out0[3 * x + 1] = (D == B && E != C) || (B == F && E != A) ? B : E;
+			out0[3 * x + 2] = B == F ? F : E;
+			out1[3 * x] = (D == B && E != G) || (D == H && E != A) ? D : E;
+			out1[3 * x + 1] = E;
+			out1[3 * x + 2] = (B == F && E != I) || (H == F && E != C) ? F : E;
+			out2[3 * x] = D == H ? D : E;
+			out2[3 * x + 1] = (D == H && E != I) || (H == F && E != G) ? H : E;
+			out2[3 * x + 2] = H == F ? F : E;
+		}
+		else
+		{
+			out0[3 * x] = out0[3 * x + 1] = out0[3 * x + 2] = E;
+			out1[3 * x] = out1[3 * x + 1] = out1[3 * x + 2] = E;
+			out2[3 * x] = out2[3 * x + 1] = out2[3 * x + 2] = E;
+		}
+	}
+}
+
+void scale_pixel_art_rows(uint32 *dst, int32 dst_bpr, const uint32 *src,
+						  int32 src_bpr, int32 width, int32 height,
+						  int32 factor, int32 first_row, int32 last_row)
+{
+	for (int32 y = first_row; y < last_row; y++)
+	{
+		const uint8 *in = (const uint8 *) src;
+		const uint32 *above = (const uint32 *) (in + (y > 0 ? y - 1 : y)
+												* src_bpr);
+		const uint32 *row = (const uint32 *) (in + y * src_bpr);
+		const uint32 *below = (const uint32 *) (in + (y < height - 1 ? y + 1
+													  : y) * src_bpr);
+
+		uint8 *out = (uint8 *) dst + (int64) y * factor * dst_bpr;
+		if (factor == 3)
+		{
+			scale3x_row((uint32 *) out, (uint32 *) (out + dst_bpr),
+						(uint32 *) (out + 2 * dst_bpr), above, row, below,
+						width);
+		}
+		else
+		{
+			scale2x_row((uint32 *) out, (uint32 *) (out + dst_bpr), above,
+						row, below, width);
+		}
+	}
+}
+
+static status_t band_thread(void *data)
+{
+	band *b = (band *) data;
+	scale_pixel_art_rows(b->dst, b->dst_bpr, b->src, b->src_bpr, b->width,
+						 b->height, b->factor, b->first_row, b->last_row);
+	return B_OK;
+}
+
+void scale_pixel_art(uint32 *dst, int32 dst_bpr, const uint32 *src,
+					 int32 src_bpr, int32 width, int32 height, int32 factor,
+					 int32 threads)
+{
+	if (threads > kMaxThreads)
+		threads = kMaxThreads;
+	if (threads > height)
+		threads = height;
+	if (threads < 1)
+		threads = 1;
+
+	// The bands only read the source and write rows of their own, so they
+	// need no locking; the calling thread takes the first one.
+	band bands[kMaxThreads];
+	thread_id ids[kMaxThreads];
+	for (int32 i = 0; i < threads; i++)
+	{
+		band &b = bands[i];
+		b.dst = dst;
+		b.dst_bpr = dst_bpr;
+		b.src = src;
+		b.src_bpr = src_bpr;
+		b.width = width;
+		b.height = height;
+		b.factor = factor;
+		b.first_row = (int32) ((int64) height * i / threads);
+		b.last_row = (int32) ((int64) height * (i + 1) / threads);
+
+		ids[i] = -1;
+		if (i > 0)
+		{
+			ids[i] = spawn_thread(band_thread, "BSOD pixel art band",
+								  B_LOW_PRIORITY, &b);
+			if (ids[i] >= 0 && resume_thread(ids[i]) != B_OK)
+				ids[i] = -1;
+		}
+	}
+
+	for (int32 i = 0; i < threads; i++)
+	{
+		// a band that got no thread is done here as well
+		if (ids[i] < 0)
+			band_thread(&bands[i]);
+	}
+
+	for (int32 i = 1; i < threads; i++)
+	{
+		status_t result;
+		if (ids[i] >= 0)
+			wait_for_thread(ids[i], &result);
+	}
+}
+
+int32 pixel_art_passes(int32 scale, int32 *factors)
+{
+	int32 best = 1, best_twos = 0, best_threes = 0;
+	for (int32 threes = 0; threes <= kMaxPixelArtPasses; threes++)
+	{
+		int64 product = 1;
+		for (int32 i = 0; i < threes; i++)
+			product *= 3;
+		for (int32 twos = 0; threes + twos <= kMaxPixelArtPasses
+			 && product <= scale; twos++, product *= 2)
+		{
+			if (product > best)
+			{
+				best = (int32) product;
+				best_twos = twos;
+				best_threes = threes;
+			}
+		}
+	}
+
+	// the cheaper passes first, while the image is still small
+	int32 count = 0;
+	for (int32 i = 0; i < best_twos; i++)
+		factors[count++] = 2;
+	for (int32 i = 0; i < best_threes; i++)
+		factors[count++] = 3;
+	return count;
+}
+
+int32 pixel_art_threads()
+{
+	system_info info;
+	if (get_system_info(&info) != B_OK || info.cpu_count < 1)
+		return 1;
+	return info.cpu_count < kMaxThreads ? info.cpu_count : kMaxThreads;
+}
@@ -0,0 +1,39 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Scale2x and Scale3x, the edge-directed pixel art scalers of AdvanceMAME:
+ * each pixel becomes a 2x2 or 3x3 block that takes the colour of a
+ * neighbour where two of its neighbours meet along a diagonal edge, so
+ * slopes stay sharp instead of turning into steps (plain stretching) or
+ * going soft (filtering).  Passes chain to 4x, 6x, 8x, 9x and so on.  The
+ * rows are cut into bands that are scaled on several threads at once.
+ */
+
+#ifndef PIXEL_SCALER_H
+#define PIXEL_SCALER_H
+
+#include <SupportDefs.h>
+
+// Scales the width x height B_RGB32 pixels at 'src' by 'factor' (2 or 3)
+// into 'dst', which holds width * factor x height * factor pixels.  Rows
+// are 'src_bpr' and 'dst_bpr' bytes apart.  The work is split into
+// 'threads' bands of rows; 1 scales everything on the calling thread.
+void scale_pixel_art(uint32 *dst, int32 dst_bpr, const uint32 *src,
+					 int32 src_bpr, int32 width, int32 height, int32 factor,
+					 int32 threads);
+
+// Rows first_row .. last_row - 1 of the source only, on this thread.
+void scale_pixel_art_rows(uint32 *dst, int32 dst_bpr, const uint32 *src,
+						  int32 src_bpr, int32 width, int32 height,
+						  int32 factor, int32 first_row, int32 last_row);
+
+// Fills 'factors' with the passes (each 2 or 3) whose product is the
+// largest that does not exceed 'scale', and returns how many there are;
+// none for a scale below 2.  'factors' needs room for kMaxPixelArtPasses.
+enum { kMaxPixelArtPasses = 8 };
+int32 pixel_art_passes(int32 scale, int32 *factors);
+
+// the number of threads worth splitting the scaling into on this machine
+int32 pixel_art_threads();
+
+#endif // PIXEL_SCALER_H
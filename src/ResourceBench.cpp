@@ -0,0 +1,148 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Lists the resources of a resource file or executable with ResourceFile,
+ * checking that each can be found again by type and id and by type and
+ * name, then times opening the file and fetching one resource against
+ * reading the whole file the way it used to be linked in.  It only needs
+ * POSIX, so it runs on the build host as well.
+ *
+ * Build and run with "make ResourceBench && ./ResourceBench BSOD".
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ResourceFile.h"
+
+static const int kRounds = 200;
+
+static int64_t now_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void print_type(uint32_t type)
+{
+	for (int shift = 24; shift >= 0; shift -= 8)
+	{
+		char c = (char) (type >> shift);
+		putchar(c >= 0x20 && c < 0x7f ? c : '.');
+	}
+}
+
+// best time to open the file, find the resource and sum its bytes
+static int64_t time_resource(const char *path, uint32_t type, int32_t id)
+{
+	int64_t best = INT64_MAX;
+	unsigned sum = 0;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		int64_t start = now_us();
+		ResourceFile file;
+		size_t size = 0;
+		const uint8_t *data = NULL;
+		if (file.SetTo(path))
+			data = (const uint8_t *) file.Find(type, id, &size);
+		for (size_t i = 0; data && i < size; i++)
+			sum += data[i];
+		file.Unset();
+		int64_t elapsed = now_us() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	// keep the sum alive
+	if (sum == 1)
+		putchar(' ');
+	return best;
+}
+
+// best time to read all of the file
+static int64_t time_read(const char *path)
+{
+	int64_t best = INT64_MAX;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		int64_t start = now_us();
+		int fd = open(path, O_RDONLY);
+		if (fd < 0)
+			return -1;
+		off_t size = lseek(fd, 0, SEEK_END);
+		char *buffer = (char *) malloc(size);
+		if (buffer && pread(fd, buffer, size, 0) != size)
+			size = 0;
+		free(buffer);
+		close(fd);
+		int64_t elapsed = now_us() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s <resource file or executable>\n", argv[0]);
+		return 1;
+	}
+
+	ResourceFile file;
+	if (!file.SetTo(argv[1]))
+	{
+		fprintf(stderr, "%s: no resources found\n", argv[1]);
+		return 1;
+	}
+
+	printf("type     id  size    name\n");
+	uint32_t largest_type = 0;
+	int32_t largest_id = 0;
+	size_t largest_size = 0;
+
+	for (int32_t i = 0; i < file.CountResources(); i++)
+	{
+		uint32_t type;
+		int32_t id;
+		const char *name;
+		size_t size, found_size;
+		file.GetResourceInfo(i, &type, &id, &name, &size);
+
+		const void *data = file.Find(type, id, &found_size);
+		if (!data || found_size != size || file.Find(type, name, &found_size)
+			!= data)
+		{
+			fprintf(stderr, "resource %d cannot be found again\n", (int) i);
+			return 1;
+		}
+
+		print_type(type);
+		printf(" %6d  %-6zu  %s\n", (int) id, size, name);
+
+		if (size > largest_size)
+		{
+			largest_type = type;
+			largest_id = id;
+			largest_size = size;
+		}
+	}
+	file.Unset();
+
+	printf("\nbest of %d rounds:\n", kRounds);
+	printf("open and read the largest resource: %" PRId64 " us\n",
+		   time_resource(argv[1], largest_type, largest_id));
+	printf("read the whole file:                %" PRId64 " us\n",
+		   time_read(argv[1]));
+	return 0;
+}
@@ -0,0 +1,280 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Checks ResourceFile against the resources the add-on is built with:
+ * the icons and version of BSOD.rsrc, and in the linked add-on, if one
+ * is given, those again and the artwork attached by the Makefile, each
+ * PKIM the size of its blob.  Copies of BSOD.rsrc cut short at every
+ * length, and with the info table moved out of the file, have to be
+ * turned down rather than read.  It only needs POSIX, so it runs on the
+ * build host as well.
+ *
+ * Build and run with "make ResourceCheck && ./ResourceCheck [BSOD]"; it
+ * exits with 1 on the first check that fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ResourceFile.h"
+
+struct expected_resource {
+	uint32_t type;
+	int32_t id;
+	const char *name;
+	size_t size;		// 0 for the size of 'blob'
+	const char *blob;
+};
+
+// what BSOD.rsrc holds, and the add-on on top of it
+static const expected_resource kResources[] = {
+	{ 'ICON', 101, "BEOS:L:STD_ICON", 1024, NULL },
+	{ 'MICN', 101, "BEOS:M:STD_ICON", 256, NULL },
+	{ 'APPV', 1, "BEOS:APP_VERSION", 680, NULL }
+};
+
+static const expected_resource kArtwork[] = {
+	{ 'PKIM', 1, "amiga_hand", 0, "amiga_hand.pkim" },
+	{ 'PKIM', 2, "atari", 0, "atari.pkim" },
+	{ 'PKIM', 3, "mac", 0, "mac.pkim" }
+};
+
+// where the info table offset is kept, from the start of BSOD.rsrc: the
+// "RS\0\0" tag, then the index section offset 8 bytes into the header
+static const size_t kIndexOffsetAt = 4 + 8;
+static const size_t kTableOffsetAt = 120;
+
+static const char *kTempPath = "/tmp/ResourceCheck.rsrc";
+
+// the whole file in a buffer to free(), NULL if it cannot be read
+static uint8_t *read_file(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	if (!file)
+		return NULL;
+
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8_t *data = length > 0 ? (uint8_t *) malloc(length) : NULL;
+	if (data && fread(data, 1, length, file) != (size_t) length)
+	{
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+
+	*size = length;
+	return data;
+}
+
+static bool write_file(const char *path, const uint8_t *data, size_t size)
+{
+	FILE *file = fopen(path, "wb");
+	if (!file)
+		return false;
+
+	bool written = fwrite(data, 1, size, file) == size;
+	return fclose(file) == 0 && written;
+}
+
+static void print_type(FILE *stream, uint32_t type)
+{
+	for (int shift = 24; shift >= 0; shift -= 8)
+		fputc((char) (type >> shift), stream);
+}
+
+// whether 'file' holds each of 'expected' by id and by name, with its
+// type, name and size; the add-on may hold more
+static bool check_resources(const char *path, const ResourceFile &file,
+							const expected_resource *expected, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		const expected_resource &e = expected[i];
+
+		size_t size = e.size;
+		if (e.blob)
+		{
+			struct stat st;
+			if (stat(e.blob, &st) != 0)
+			{
+				fprintf(stderr, "%s: cannot be read, see \"make artwork\"\n",
+						e.blob);
+				return false;
+			}
+			size = st.st_size;
+		}
+
+		// the index entry, as ResourceBench lists it
+		int32_t index = 0;
+		for (; index < file.CountResources(); index++)
+		{
+			uint32_t type;
+			int32_t id;
+			const char *name;
+			size_t found_size;
+			file.GetResourceInfo(index, &type, &id, &name, &found_size);
+			if (type == e.type && id == e.id)
+			{
+				if (strcmp(name, e.name) != 0 || found_size != size)
+					index = file.CountResources();
+				break;
+			}
+		}
+
+		size_t by_id_size = 0, by_name_size = 0;
+		const void *by_id = file.Find(e.type, e.id, &by_id_size);
+		const void *by_name = file.Find(e.type, e.name, &by_name_size);
+		if (index == file.CountResources() || !by_id || by_id != by_name
+			|| by_id_size != size || by_name_size != size)
+		{
+			fprintf(stderr, "%s: no ", path);
+			print_type(stderr, e.type);
+			fprintf(stderr, " %d \"%s\" of %zu bytes\n", (int) e.id, e.name,
+					size);
+			return false;
+		}
+
+		printf("%s: ", path);
+		print_type(stdout, e.type);
+		printf(" %6d  %-6zu  %s\n", (int) e.id, size, e.name);
+	}
+
+	return true;
+}
+
+// whether a copy of 'data' that is broken is turned down, saying which
+// one is not
+static bool check_refused(const uint8_t *data, size_t size,
+						  const char *what)
+{
+	if (!write_file(kTempPath, data, size))
+	{
+		fprintf(stderr, "%s: cannot be written\n", kTempPath);
+		return false;
+	}
+
+	ResourceFile file;
+	if (file.SetTo(kTempPath))
+	{
+		fprintf(stderr, "BSOD.rsrc %s: read as %d resources\n", what,
+				(int) file.CountResources());
+		return false;
+	}
+	return true;
+}
+
+static void put32(uint8_t *data, uint32_t value, bool swap)
+{
+	if (swap)
+		value = __builtin_bswap32(value);
+	memcpy(data, &value, sizeof(value));
+}
+
+static uint32_t get32(const uint8_t *data, bool swap)
+{
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return swap ? __builtin_bswap32(value) : value;
+}
+
+static bool check_damaged(const uint8_t *data, size_t size)
+{
+	char what[64];
+
+	// the info table comes last, so every length short of the file loses
+	// some of it at least
+	for (size_t length = 0; length < size; length++)
+	{
+		snprintf(what, sizeof(what), "cut to %zu bytes", length);
+		if (!check_refused(data, length, what))
+			return false;
+	}
+
+	// the file is of the other byte order if the magic reads backwards
+	bool swap = get32(data + 4, false) != 0x444f1000;
+	uint32_t index_offset = get32(data + kIndexOffsetAt, swap);
+	if (4 + (size_t) index_offset + kTableOffsetAt + 4 > size)
+	{
+		fprintf(stderr, "BSOD.rsrc: index section out of the file\n");
+		return false;
+	}
+
+	uint8_t *copy = (uint8_t *) malloc(size);
+	if (!copy)
+		return false;
+
+	static const uint32_t kOffsets[] = { (uint32_t) size, 0x7ffffff0,
+										 0xfffffff0, 0xffffffff };
+	bool ok = true;
+	for (size_t i = 0; ok && i < sizeof(kOffsets) / sizeof(kOffsets[0]); i++)
+	{
+		memcpy(copy, data, size);
+		put32(copy + 4 + index_offset + kTableOffsetAt, kOffsets[i], swap);
+		snprintf(what, sizeof(what), "with the info table at 0x%x",
+				 (unsigned) kOffsets[i]);
+		ok = check_refused(copy, size, what);
+	}
+
+	free(copy);
+	unlink(kTempPath);
+	if (ok)
+		printf("BSOD.rsrc: %zu cut short and 4 with the info table out of "
+			   "the file turned down\n", size);
+	return ok;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "usage: %s [<add-on>]\n", argv[0]);
+		return 1;
+	}
+
+	static const int kResourceCount = sizeof(kResources)
+		/ sizeof(kResources[0]);
+	static const int kArtworkCount = sizeof(kArtwork) / sizeof(kArtwork[0]);
+
+	ResourceFile file;
+	if (!file.SetTo("BSOD.rsrc"))
+	{
+		fprintf(stderr, "BSOD.rsrc: no resources found\n");
+		return 1;
+	}
+	if (file.CountResources() != kResourceCount)
+	{
+		fprintf(stderr, "BSOD.rsrc: %d resources, %d expected\n",
+				(int) file.CountResources(), kResourceCount);
+		return 1;
+	}
+	if (!check_resources("BSOD.rsrc", file, kResources, kResourceCount))
+		return 1;
+	file.Unset();
+
+	if (argc == 2)
+	{
+		if (!file.SetTo(argv[1]))
+		{
+			fprintf(stderr, "%s: no resources found\n", argv[1]);
+			return 1;
+		}
+		if (!check_resources(argv[1], file, kResources, kResourceCount)
+			|| !check_resources(argv[1], file, kArtwork, kArtworkCount))
+			return 1;
+		file.Unset();
+	}
+
+	size_t size;
+	uint8_t *data = read_file("BSOD.rsrc", &size);
+	if (!data)
+		return 1;
+	bool ok = check_damaged(data, size);
+	free(data);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,355 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ResourceFile: a read-only parser of the BeOS/Haiku resource format,
+ * for a plain resource file (like BSOD.rsrc) or an ELF executable with
+ * resources attached by xres.  The file is memory mapped, and only the
+ * index is read when it is opened, so the data of a resource is paged
+ * in when it is first used.  It only needs POSIX, so it can be built
+ * and tried on any host (see ResourceBench).
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ResourceFile.h"
+
+// The layout, all offsets relative to the resources header:
+//
+//	resources header		magic, resource count, index section offset
+//	index section			132 byte header with the info table position,
+//							then one {offset, size, pad} per resource
+//	data
+//	info table				per type: the type code, then {id, index,
+//							name size, name} per resource, ended by a
+//							0xffffffff 0xffffffff separator; then a
+//							checksum and a 0 terminator
+//
+// A resource file starts with "RS\0\0" and the resources header follows;
+// in an executable the resources header is appended after the last
+// segment or section, aligned to at least 32 bytes.
+static const uint32_t kResourcesMagic = 0x444f1000;
+static const uint32_t kResourcesHeaderSize = 68;
+static const uint32_t kIndexHeaderSize = 132;
+static const uint32_t kIndexEntrySize = 12;
+static const uint32_t kInfoSeparator = 0xffffffff;
+static const uint32_t kInfoTableEndSize = 8;
+
+static const uint64_t kMinELFAlignment = 32;
+static const uint64_t kMaxELFAlignment = 128 * 1024;
+
+// ELF fields, in the byte order given by the file
+static uint64_t elf_field(const uint8_t *data, int size, bool big_endian)
+{
+	uint64_t value = 0;
+	for (int i = 0; i < size; i++)
+	{
+		int byte = big_endian ? i : size - 1 - i;
+		value = (value << 8) | data[byte];
+	}
+	return value;
+}
+
+ResourceFile::ResourceFile()
+{
+	m_data = NULL;
+	m_size = 0;
+	m_resources = NULL;
+	m_resources_size = 0;
+	m_swap = false;
+	m_index = NULL;
+	m_count = 0;
+}
+
+ResourceFile::~ResourceFile()
+{
+	Unset();
+}
+
+bool ResourceFile::SetTo(const char *path)
+{
+	Unset();
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t) kResourcesHeaderSize)
+	{
+		close(fd);
+		return false;
+	}
+
+	void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return false;
+
+	m_data = (const uint8_t *) data;
+	m_size = st.st_size;
+
+	uint64_t offset;
+	if (!find_resources(&offset) || !read_index(offset))
+	{
+		Unset();
+		return false;
+	}
+
+	return true;
+}
+
+void ResourceFile::Unset()
+{
+	if (m_data)
+		munmap((void *) m_data, m_size);
+	free(m_index);
+
+	m_data = NULL;
+	m_size = 0;
+	m_resources = NULL;
+	m_resources_size = 0;
+	m_swap = false;
+	m_index = NULL;
+	m_count = 0;
+}
+
+bool ResourceFile::GetResourceInfo(int32_t index, uint32_t *type,
+								   int32_t *id, const char **name,
+								   size_t *size) const
+{
+	if (index < 0 || index >= m_count)
+		return false;
+
+	const resource &r = m_index[index];
+	*type = r.type;
+	*id = r.id;
+	*name = r.name;
+	*size = r.size;
+	return true;
+}
+
+const void *ResourceFile::Find(uint32_t type, int32_t id, size_t *size) const
+{
+	for (int32_t i = 0; i < m_count; i++)
+	{
+		const resource &r = m_index[i];
+		if (r.type == type && r.id == id)
+		{
+			*size = r.size;
+			return m_resources + r.offset;
+		}
+	}
+	return NULL;
+}
+
+const void *ResourceFile::Find(uint32_t type, const char *name,
+							   size_t *size) const
+{
+	for (int32_t i = 0; i < m_count; i++)
+	{
+		const resource &r = m_index[i];
+		if (r.type == type && strcmp(r.name, name) == 0)
+		{
+			*size = r.size;
+			return m_resources + r.offset;
+		}
+	}
+	return NULL;
+}
+
+bool ResourceFile::find_resources(uint64_t *offset) const
+{
+	if (memcmp(m_data, "RS\0\0", 4) == 0)
+	{
+		*offset = 4;
+		return true;
+	}
+
+	if (memcmp(m_data, "\x7f" "ELF", 4) == 0)
+		return find_elf_resources(offset);
+
+	return false;
+}
+
+bool ResourceFile::find_elf_resources(uint64_t *offset) const
+{
+	bool is64 = m_data[4] == 2;
+	bool big_endian = m_data[5] == 2;
+	size_t header_size = is64 ? 64 : 52;
+	if (m_size < header_size)
+		return false;
+
+	const uint8_t *header = m_data;
+	uint64_t ph_offset = elf_field(header + (is64 ? 32 : 28), is64 ? 8 : 4,
+								   big_endian);
+	uint64_t sh_offset = elf_field(header + (is64 ? 40 : 32), is64 ? 8 : 4,
+								   big_endian);
+	uint64_t ph_size = elf_field(header + (is64 ? 54 : 42), 2, big_endian);
+	uint64_t ph_count = elf_field(header + (is64 ? 56 : 44), 2, big_endian);
+	uint64_t sh_size = elf_field(header + (is64 ? 58 : 46), 2, big_endian);
+	uint64_t sh_count = elf_field(header + (is64 ? 60 : 48), 2, big_endian);
+
+	if (ph_offset + ph_size * ph_count > m_size
+		|| sh_offset + sh_size * sh_count > m_size)
+		return false;
+
+	// the resources follow whatever of the file is used last
+	uint64_t end = header_size;
+	if (ph_offset + ph_size * ph_count > end)
+		end = ph_offset + ph_size * ph_count;
+	if (sh_offset + sh_size * sh_count > end)
+		end = sh_offset + sh_size * sh_count;
+
+	for (uint64_t i = 0; i < ph_count; i++)
+	{
+		const uint8_t *ph = m_data + ph_offset + i * ph_size;
+		uint64_t type = elf_field(ph, 4, big_endian);
+		uint64_t file_offset = elf_field(ph + (is64 ? 8 : 4), is64 ? 8 : 4,
+										 big_endian);
+		uint64_t file_size = elf_field(ph + (is64 ? 32 : 16), is64 ? 8 : 4,
+									   big_endian);
+		if (type != 0 && file_offset + file_size > end)
+			end = file_offset + file_size;
+	}
+
+	for (uint64_t i = 0; i < sh_count; i++)
+	{
+		const uint8_t *sh = m_data + sh_offset + i * sh_size;
+		uint64_t type = elf_field(sh + 4, 4, big_endian);
+		uint64_t file_offset = elf_field(sh + (is64 ? 24 : 16), is64 ? 8 : 4,
+										 big_endian);
+		uint64_t file_size = elf_field(sh + (is64 ? 32 : 20), is64 ? 8 : 4,
+									   big_endian);
+		// SHT_NULL and SHT_NOBITS take no room in the file
+		if (type != 0 && type != 8 && file_offset + file_size > end)
+			end = file_offset + file_size;
+	}
+
+	// The alignment xres picked depends on the segments; rather than
+	// second guess it, try each one it may have used.
+	for (uint64_t align = kMinELFAlignment; align <= kMaxELFAlignment;
+		 align *= 2)
+	{
+		uint64_t candidate = (end + align - 1) & ~(align - 1);
+		uint32_t magic;
+		if (candidate + kResourcesHeaderSize > m_size)
+			break;
+		memcpy(&magic, m_data + candidate, sizeof(magic));
+		if (magic == kResourcesMagic
+			|| __builtin_bswap32(magic) == kResourcesMagic)
+		{
+			*offset = candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ResourceFile::read32(uint64_t offset, uint32_t *value) const
+{
+	if (offset + 4 > m_resources_size)
+		return false;
+	memcpy(value, m_resources + offset, 4);
+	if (m_swap)
+		*value = __builtin_bswap32(*value);
+	return true;
+}
+
+bool ResourceFile::read_index(uint64_t offset)
+{
+	m_resources = m_data + offset;
+	m_resources_size = m_size - offset;
+
+	uint32_t magic;
+	memcpy(&magic, m_resources, sizeof(magic));
+	if (magic != kResourcesMagic)
+	{
+		if (__builtin_bswap32(magic) != kResourcesMagic)
+			return false;
+		m_swap = true;
+	}
+
+	uint32_t count, index_offset, section_size, table_offset, table_size;
+	if (!read32(4, &count) || !read32(8, &index_offset)
+		|| !read32(index_offset + 4, &section_size)
+		|| !read32(index_offset + 120, &table_offset)
+		|| !read32(index_offset + 124, &table_size))
+		return false;
+
+	if (section_size < kIndexHeaderSize || count == 0
+		|| count > (section_size - kIndexHeaderSize) / kIndexEntrySize
+		|| (uint64_t) index_offset + section_size > m_resources_size
+		|| (uint64_t) table_offset + table_size > m_resources_size
+		|| table_size < kInfoTableEndSize)
+		return false;
+
+	m_index = (resource *) calloc(count, sizeof(resource));
+	if (!m_index)
+		return false;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		resource &r = m_index[i];
+		uint64_t entry = index_offset + kIndexHeaderSize + i * kIndexEntrySize;
+		if (!read32(entry, &r.offset) || !read32(entry + 4, &r.size)
+			|| (uint64_t) r.offset + r.size > m_resources_size)
+			return false;
+	}
+
+	// Walk the info table for the types, ids and names; the index has no
+	// use for entries it does not describe.
+	uint64_t pos = table_offset;
+	uint64_t end = (uint64_t) table_offset + table_size - kInfoTableEndSize;
+	while (pos < end)
+	{
+		uint32_t type;
+		if (!read32(pos, &type))
+			return false;
+		pos += 4;
+
+		for (;;)
+		{
+			uint32_t id, index;
+			if (pos + 8 > end || !read32(pos, &id) || !read32(pos + 4, &index))
+				return false;
+			if (id == kInfoSeparator && index == kInfoSeparator)
+			{
+				pos += 8;
+				break;
+			}
+			if (pos + 10 > end)
+				return false;
+
+			uint16_t name_size;
+			memcpy(&name_size, m_resources + pos + 8, sizeof(name_size));
+			if (m_swap)
+				name_size = __builtin_bswap16(name_size);
+
+			const char *name = (const char *) m_resources + pos + 10;
+			pos += 10 + name_size;
+			if (pos > end || index < 1 || index > count
+				|| (name_size > 0 && name[name_size - 1] != '\0'))
+				return false;
+
+			// the index is counted from 1
+			resource &r = m_index[index - 1];
+			r.type = type;
+			r.id = (int32_t) id;
+			r.name = name_size > 0 ? name : "";
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (m_index[i].name)
+			m_index[m_count++] = m_index[i];
+	}
+
+	return m_count > 0;
+}
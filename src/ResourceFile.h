@@ -0,0 +1,63 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ResourceFile: a read-only parser of the BeOS/Haiku resource format,
+ * for a plain resource file (like BSOD.rsrc) or an ELF executable with
+ * resources attached by xres.  The file is memory mapped, and only the
+ * index is read when it is opened, so the data of a resource is paged
+ * in when it is first used.  It only needs POSIX, so it can be built
+ * and tried on any host (see ResourceBench).
+ */
+
+#ifndef RESOURCE_FILE_H
+#define RESOURCE_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class ResourceFile {
+ public:
+	ResourceFile();
+	~ResourceFile();
+
+	// Maps the file and reads its resource index; false if the file
+	// cannot be read or has no valid resources.
+	bool SetTo(const char *path);
+	void Unset();
+	bool IsValid() const { return m_data != NULL; }
+
+	int32_t CountResources() const { return m_count; }
+	// the type, id, name and size of the index'th resource
+	bool GetResourceInfo(int32_t index, uint32_t *type, int32_t *id,
+						 const char **name, size_t *size) const;
+
+	// The data of a resource, valid until Unset(); NULL if there is no
+	// such resource.
+	const void *Find(uint32_t type, int32_t id, size_t *size) const;
+	const void *Find(uint32_t type, const char *name, size_t *size) const;
+
+ private:
+	struct resource {
+		uint32_t type;
+		int32_t id;
+		const char *name;	// in the mapping
+		uint32_t offset;	// from m_resources
+		uint32_t size;
+	};
+
+	bool find_resources(uint64_t *offset) const;
+	bool find_elf_resources(uint64_t *offset) const;
+	bool read_index(uint64_t offset);
+	bool read32(uint64_t offset, uint32_t *value) const;
+
+	const uint8_t *m_data;
+	size_t m_size;
+	const uint8_t *m_resources;	// the resources header in the mapping
+	size_t m_resources_size;
+	bool m_swap;				// the file is of the other byte order
+
+	resource *m_index;
+	int32_t m_count;
+};
+
+#endif // RESOURCE_FILE_H
@@ -0,0 +1,138 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Benchmark for the pixel art scaler: blows an image the size of the
+ * Guru Meditation hand (208x257) up 2x, 3x, 4x, 6x and 9x, the last about
+ * what an 8K screen takes, with one thread and then with more up to the
+ * number of CPUs.  Every thread count has to give the same pixels as one
+ * thread before its time is shown.
+ *
+ * Build and run with "make ScalerBench && ./ScalerBench".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <OS.h>
+
+#include "PixelScaler.h"
+
+static const int32 kWidth = 208;
+static const int32 kHeight = 257;
+static const int kRounds = 10;
+
+// Scales through all the passes for 'scale', the way the asset cache
+// does; the result is in the buffer returned, its size in width, height.
+static uint32 *upscale(uint32 *buffers[2], const uint32 *src, int32 scale,
+					   int32 threads, int32 *width, int32 *height)
+{
+	int32 factors[kMaxPixelArtPasses];
+	int32 passes = pixel_art_passes(scale, factors);
+	const uint32 *from = src;
+	*width = kWidth;
+	*height = kHeight;
+
+	for (int32 i = 0; i < passes; i++)
+	{
+		uint32 *to = buffers[i % 2];
+		scale_pixel_art(to, *width * factors[i] * sizeof(uint32), from,
+						*width * sizeof(uint32), *width, *height, factors[i],
+						threads);
+		*width *= factors[i];
+		*height *= factors[i];
+		from = to;
+	}
+
+	return (uint32 *) from;
+}
+
+static bigtime_t time_upscale(uint32 *buffers[2], const uint32 *src,
+							  int32 scale, int32 threads)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+	int32 width, height;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		upscale(buffers, src, scale, threads, &width, &height);
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+int main()
+{
+	static const int32 kScales[] = { 2, 3, 4, 6, 9 };
+	static const int32 kMaxScale = 9;
+
+	// a few colours in blobs and diagonals, like the artwork
+	uint32 *src = (uint32 *) malloc(kWidth * kHeight * sizeof(uint32));
+	size_t size = (size_t) kWidth * kHeight * kMaxScale * kMaxScale
+		* sizeof(uint32);
+	uint32 *buffers[2] = { (uint32 *) malloc(size), (uint32 *) malloc(size) };
+	uint32 *check = (uint32 *) malloc(size);
+	if (!src || !buffers[0] || !buffers[1] || !check)
+		return 1;
+
+	static const uint32 kColors[] = { 0xff000000, 0xffffffff, 0xff8a5a28,
+									  0xffc8a064 };
+	srand(1);
+	for (int32 y = 0; y < kHeight; y++)
+	{
+		for (int32 x = 0; x < kWidth; x++)
+		{
+			int32 shade = ((x + y) / 7 + (x - y + kHeight) / 11) % 3;
+			src[y * kWidth + x] = rand() % 50 == 0 ? kColors[3]
+				: kColors[shade];
+		}
+	}
+
+	int32 cpus = pixel_art_threads();
+	printf("%" B_PRId32 "x%" B_PRId32 ", %" B_PRId32 " CPUs, best of %d "
+		   "rounds\n\n", kWidth, kHeight, cpus, kRounds);
+	printf("scale  output       threads      time  speedup  Mpixels/s\n");
+
+	for (size_t i = 0; i < sizeof(kScales) / sizeof(kScales[0]); i++)
+	{
+		int32 scale = kScales[i];
+		int32 width, height;
+		uint32 *out = upscale(buffers, src, scale, 1, &width, &height);
+		memcpy(check, out, (size_t) width * height * sizeof(uint32));
+
+		bigtime_t single = 0;
+		for (int32 threads = 1; threads <= cpus;
+			 threads = threads * 2 > cpus ? cpus : threads * 2)
+		{
+			out = upscale(buffers, src, scale, threads, &width, &height);
+			if (memcmp(check, out, (size_t) width * height * sizeof(uint32))
+					!= 0)
+			{
+				printf("%" B_PRId32 "x with %" B_PRId32 " threads: output "
+					   "differs from one thread\n", scale, threads);
+				return 1;
+			}
+
+			bigtime_t elapsed = time_upscale(buffers, src, scale, threads);
+			if (threads == 1)
+				single = elapsed;
+			printf("%4" B_PRId32 "x  %5" B_PRId32 "x%-5" B_PRId32 "  %7"
+				   B_PRId32 "  %6" B_PRIdBIGTIME " us  %6.1fx  %9.0f\n",
+				   scale, width, height, threads, elapsed,
+				   (double) single / elapsed,
+				   (double) width * height / elapsed);
+			if (threads == cpus)
+				break;
+		}
+	}
+
+	free(src);
+	free(buffers[0]);
+	free(buffers[1]);
+	free(check);
+	return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ScriptGlyphs: the crash texts decoded into the glyphs of a font's
+ * encoding.  Each text is decoded the first time it is drawn with an
+ * encoding and kept until Clear().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Debug.h>
+
+#include "ScriptGlyphs.h"
+
+ScriptGlyphs::ScriptGlyphs()
+{
+}
+
+ScriptGlyphs::~ScriptGlyphs()
+{
+	Clear();
+}
+
+const char *ScriptGlyphs::Glyphs(const crash_script &script,
+								 text_encoding encoding)
+{
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		entry *e = (entry *) m_entries.ItemAt(i);
+		if (e->script == &script && e->encoding == encoding)
+			return e->glyphs;
+	}
+
+	// the glyphs live right behind their entry
+	entry *e = (entry *) malloc(sizeof(entry) + strlen(script.text));
+	if (!e)
+		return NULL;
+
+	e->script = &script;
+	e->encoding = encoding;
+	e->glyphs = (char *) (e + 1);
+
+	int32 count = decode_text(script.text, strlen(script.text),
+							  kEncodingUTF8, encoding, e->glyphs);
+	if (count != script.glyph_count)
+	{
+		// the layout would not match the glyphs
+		PRINT(("ScriptGlyphs: decoder and layout disagree\n"));
+		free(e);
+		return NULL;
+	}
+
+	m_entries.AddItem(e);
+	return e->glyphs;
+}
+
+size_t ScriptGlyphs::Bytes() const
+{
+	size_t bytes = 0;
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+	{
+		const entry *e = (const entry *) m_entries.ItemAt(i);
+		bytes += sizeof(entry) + strlen(e->script->text);
+	}
+	return bytes;
+}
+
+void ScriptGlyphs::Clear()
+{
+	for (int32 i = 0; i < m_entries.CountItems(); i++)
+		free(m_entries.ItemAt(i));
+	m_entries.MakeEmpty();
+}
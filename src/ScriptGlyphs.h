@@ -0,0 +1,39 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ScriptGlyphs: the crash texts decoded into the glyphs of a font's
+ * encoding.  Each text is decoded the first time it is drawn with an
+ * encoding and kept until Clear().
+ */
+
+#ifndef SCRIPT_GLYPHS_H
+#define SCRIPT_GLYPHS_H
+
+#include <List.h>
+
+#include "ScriptLayout.h"
+#include "TextEncoding.h"
+
+class ScriptGlyphs {
+ public:
+	ScriptGlyphs();
+	~ScriptGlyphs();
+
+	// The glyphs of 'script' in 'encoding', script.glyph_count of them, to
+	// be indexed by the offsets of its lines; NULL if out of memory.
+	const char *Glyphs(const crash_script &script, text_encoding encoding);
+	void Clear();
+	// the memory the decoded glyphs take
+	size_t Bytes() const;
+
+ private:
+	struct entry {
+		const crash_script *script;
+		text_encoding encoding;
+		char *glyphs;
+	};
+
+	BList m_entries;
+};
+
+#endif // SCRIPT_GLYPHS_H
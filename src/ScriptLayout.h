@@ -0,0 +1,115 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Layout tables for the built-in crash texts, computed by the compiler.
+ * A script is split into lines at '\n'; a line starting with '_' is
+ * centered within the widest line of the script, one starting with '@'
+ * is centered and drawn inverted.  The marker itself is not drawn.
+ * Texts are UTF-8; offsets and widths count glyphs, not bytes, and index
+ * the text once it has been decoded for a font (see ScriptGlyphs).
+ */
+
+#ifndef SCRIPT_LAYOUT_H
+#define SCRIPT_LAYOUT_H
+
+#include <SupportDefs.h>
+
+struct script_line {
+	uint16 offset;		// first glyph to draw, past any marker
+	uint16 length;		// glyphs to draw
+	uint16 indent;		// columns to skip for centered lines
+	uint16 text_offset;	// the same in bytes of the UTF-8 text
+	uint16 text_length;
+	bool centered;
+	bool inverted;
+};
+
+struct crash_script {
+	const char *text;
+	const script_line *lines;
+	int32 line_count;
+	int32 columns;		// width of the widest line, markers included
+	int32 glyph_count;	// glyphs in the whole text
+};
+
+template<int32 N>
+struct script_table {
+	script_line lines[N];
+	int32 columns;
+	int32 glyph_count;
+};
+
+constexpr bool utf8_continuation(char c)
+{
+	return (c & 0xc0) == 0x80;
+}
+
+constexpr int32 script_line_count(const char *text)
+{
+	int32 count = 1;
+	for (; *text; text++)
+		if (*text == '\n')
+			count++;
+	return count;
+}
+
+template<int32 N>
+constexpr script_table<N> make_script_table(const char *text)
+{
+	script_table<N> table = {};
+
+	// a glyph starts at every byte that is not a UTF-8 continuation byte
+	int32 line = 0, start = 0, start_byte = 0, glyph = 0;
+	for (int32 i = 0; ; i++)
+	{
+		if (text[i] == '\n' || !text[i])
+		{
+			if (glyph - start > table.columns)
+				table.columns = glyph - start;
+
+			script_line &l = table.lines[line++];
+			l.offset = start;
+			l.length = glyph - start;
+			l.text_offset = start_byte;
+			l.text_length = i - start_byte;
+			if (text[start_byte] == '@' || text[start_byte] == '_')
+			{
+				l.centered = true;
+				l.inverted = text[start_byte] == '@';
+				l.offset++;
+				l.length--;
+				l.text_offset++;
+				l.text_length--;
+			}
+			start = glyph + 1;
+			start_byte = i + 1;
+		}
+		if (!text[i])
+			break;
+		if (!utf8_continuation(text[i]))
+			glyph++;
+	}
+	table.glyph_count = glyph;
+
+	// centering needs the width of the whole block, hence a second pass
+	for (int32 i = 0; i < N; i++)
+	{
+		script_line &l = table.lines[i];
+		if (l.centered)
+			l.indent = (table.columns - l.length) / 2;
+	}
+
+	return table;
+}
+
+// Defines 'name' as a crash_script for the string literal 'string'.
+#define CRASH_SCRIPT(name, string) \
+	static constexpr const char name##_text[] = string; \
+	static constexpr script_table<script_line_count(name##_text)> \
+		name##_table = make_script_table< \
+			script_line_count(name##_text)>(name##_text); \
+	static constexpr crash_script name = { name##_text, name##_table.lines, \
+		script_line_count(name##_text), name##_table.columns, \
+		name##_table.glyph_count }
+
+#endif // SCRIPT_LAYOUT_H
@@ -0,0 +1,121 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ShuffleBag: picks items at random the way one draws from a bag, every
+ * item going in as often as its weight and the bag refilled when empty,
+ * so over a bag each comes up as often as it should and none is left out
+ * for long.  The same item never comes up twice in a row unless there is
+ * no other.  The next item is drawn one ahead, so it is known before it
+ * is needed.
+ */
+
+#include <stdlib.h>
+
+#include "ShuffleBag.h"
+
+ShuffleBag::ShuffleBag(int32 count)
+{
+	m_count = count < kMaxItems ? count : kMaxItems;
+	for (int32 i = 0; i < kMaxItems; i++)
+		m_weights[i] = 1;
+
+	m_size = 0;
+	m_last = -1;
+	m_next = -1;
+}
+
+void ShuffleBag::SetWeight(int32 item, int32 weight)
+{
+	if (item < 0 || item >= m_count)
+		return;
+
+	if (weight < 0)
+		weight = 0;
+	if (weight > kMaxWeight)
+		weight = kMaxWeight;
+	m_weights[item] = weight;
+
+	// the bag and the item drawn ahead were for the old weights
+	m_size = 0;
+	m_next = -1;
+}
+
+int32 ShuffleBag::Weight(int32 item) const
+{
+	return item >= 0 && item < m_count ? m_weights[item] : 0;
+}
+
+int32 ShuffleBag::Peek()
+{
+	if (m_next < 0)
+		m_next = draw();
+	return m_next;
+}
+
+int32 ShuffleBag::Next()
+{
+	int32 item = Peek();
+	m_next = -1;
+	return item;
+}
+
+// Puts every item into the bag as often as its weight.
+void ShuffleBag::refill()
+{
+	int32 total = 0;
+	for (int32 i = 0; i < m_count; i++)
+		total += m_weights[i];
+
+	for (int32 i = 0; i < m_count; i++)
+	{
+		int32 weight = total > 0 ? m_weights[i] : 1;
+		for (int32 j = 0; j < weight; j++)
+			m_bag[m_size++] = i;
+	}
+}
+
+int32 ShuffleBag::draw()
+{
+	if (m_size == 0)
+		refill();
+
+	// anything but the last one; a bag left with only that one is thrown
+	// away for a new one rather than repeating it, which shortchanges
+	// it if it weighs more than all the others together
+	int32 others = 0;
+	for (int32 i = 0; i < m_size; i++)
+	{
+		if (m_bag[i] != m_last)
+			others++;
+	}
+	if (others == 0)
+	{
+		m_size = 0;
+		refill();
+		for (int32 i = 0; i < m_size; i++)
+		{
+			if (m_bag[i] != m_last)
+				others++;
+		}
+	}
+
+	if (m_size == 0)
+		return -1;
+
+	// with a single item to pick from, it has to repeat
+	int32 index = 0;
+	if (others > 0)
+	{
+		int32 pick = rand() % others;
+		for (index = 0; index < m_size; index++)
+		{
+			if (m_bag[index] != m_last && pick-- == 0)
+				break;
+		}
+	}
+
+	int32 item = m_bag[index];
+	m_bag[index] = m_bag[--m_size];
+	m_last = item;
+	return item;
+}
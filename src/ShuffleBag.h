@@ -0,0 +1,48 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * ShuffleBag: picks items at random the way one draws from a bag, every
+ * item going in as often as its weight and the bag refilled when empty,
+ * so over a bag each comes up as often as it should and none is left out
+ * for long.  The same item never comes up twice in a row unless there is
+ * no other.  The next item is drawn one ahead, so it is known before it
+ * is needed.
+ */
+
+#ifndef SHUFFLE_BAG_H
+#define SHUFFLE_BAG_H
+
+#include <SupportDefs.h>
+
+class ShuffleBag {
+ public:
+	enum { kMaxItems = 16, kMaxWeight = 8 };
+
+	// items 0 .. count - 1, each with a weight of 1
+	ShuffleBag(int32 count);
+
+	// How often an item goes into each bag, 0 to leave it out; if every
+	// weight is 0, all count as 1.  Starts a new bag.
+	void SetWeight(int32 item, int32 weight);
+	int32 Weight(int32 item) const;
+
+	// the item Next() returns, drawn now if it was not yet
+	int32 Peek();
+	int32 Next();
+
+ private:
+	int32 draw();
+	void refill();
+
+	int32 m_count;
+	int32 m_weights[kMaxItems];
+
+	// what is left of the bag
+	int32 m_bag[kMaxItems * kMaxWeight];
+	int32 m_size;
+
+	int32 m_last;	// drawn last
+	int32 m_next;	// drawn ahead, -1 if not yet
+};
+
+#endif // SHUFFLE_BAG_H
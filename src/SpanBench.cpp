@@ -0,0 +1,167 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Microbenchmark for the 1bpp to B_RGB32 span expander: expands a screen
+ * full of text rows at 3840x2160, as the NT crash screen composes it at
+ * 4K, with the scalar loop and with the variant picked for this machine.
+ * Each is timed once writing a single row that stays in the cache, which
+ * is the cost of the expansion itself, and once writing the whole screen,
+ * which is bound by memory bandwidth; a memset() of the screen is given
+ * for comparison.  Before any timing the variant has to agree with the
+ * scalar loop up to scale 8, for odd and unaligned starts and lengths.
+ *
+ * Build and run with "make SpanBench && ./SpanBench".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <OS.h>
+
+#include "SpanExpander.h"
+
+static const int kWidth = 3840;
+static const int kHeight = 2160;
+static const int kRounds = 20;
+
+// scales checked against the scalar loop, beyond the ones timed
+static const int kCheckScales = 8;
+
+typedef void (*expand_func)(uint32 *dst, const uint8 *src, int first,
+							int count, int scale, uint32 fg, uint32 bg);
+
+// best time to expand one screen, one span per row; all rows go to the
+// same place unless 'whole_screen' is set
+static bigtime_t time_screen(expand_func expand, const uint8 *src,
+							 uint32 *dst, int scale, bool whole_screen)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		for (int y = 0; y < kHeight; y++)
+			expand(dst + (whole_screen ? y * kWidth : 0),
+				   src + (y % 16) * (kWidth / 8), 0, kWidth, scale,
+				   0xffffffff, 0xff800000);
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+// Whether expand_span() writes what the scalar loop writes, and nothing
+// around it, for odd and unaligned starts and lengths and for a
+// destination that is not 16 byte aligned.
+static bool check_scale(const uint8 *src, uint32 *check, uint32 *dst,
+						int scale)
+{
+	static const int kFirsts[] = { 0, 1, 3, 7, 8, 13, 31, 33, 63, 129 };
+	static const int kCounts[] = { 1, 2, 3, 5, 7, 9, 15, 17, 31, 33, 63,
+								   65, 127, 255, 257, 1001 };
+	static const uint32 kGuard = 0x12345678;
+
+	for (size_t f = 0; f < sizeof(kFirsts) / sizeof(kFirsts[0]); f++)
+	{
+		for (size_t c = 0; c <= sizeof(kCounts) / sizeof(kCounts[0]); c++)
+		{
+			int first = kFirsts[f];
+			// and the rest of the row, whatever length that leaves
+			int count = c < sizeof(kCounts) / sizeof(kCounts[0])
+				? kCounts[c] : kWidth - first - 1;
+
+			for (int offset = 0; offset < 4; offset++)
+			{
+				for (int i = 0; i < count + 2; i++)
+					check[offset + i] = dst[offset + i] = kGuard;
+
+				expand_span_scalar(check + offset + 1, src, first, count,
+								   scale, 0xffffffff, 0xff800000);
+				expand_span(dst + offset + 1, src, first, count, scale,
+							0xffffffff, 0xff800000);
+				if (memcmp(check + offset, dst + offset,
+						   (count + 2) * sizeof(uint32)) != 0)
+				{
+					printf("scale %d, first %d, count %d, dst + %d: output "
+						   "differs from the scalar loop\n", scale, first,
+						   count, offset + 1);
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+static bigtime_t time_memset(uint32 *dst)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		memset(dst, round, kWidth * kHeight * sizeof(uint32));
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+int main()
+{
+	// 16 rows of random glyph bits are enough to defeat any caching of
+	// the source; the destination is a whole 4K screen
+	uint8 *src = (uint8 *) malloc(16 * kWidth / 8);
+	uint32 *dst = (uint32 *) malloc(kWidth * kHeight * sizeof(uint32));
+	uint32 *check = (uint32 *) malloc((kWidth + 8) * sizeof(uint32));
+	if (!src || !dst || !check)
+		return 1;
+
+	srand(1);
+	for (int i = 0; i < 16 * kWidth / 8; i++)
+		src[i] = rand();
+
+	printf("expand_span variant: %s\n", expand_span_variant());
+
+	// both have to agree before their timings mean anything
+	for (int scale = 1; scale <= kCheckScales; scale++)
+	{
+		if (!check_scale(src, check, dst, scale))
+			return 1;
+	}
+	printf("agrees with the scalar loop up to scale %d\n", kCheckScales);
+	printf("%dx%d, best of %d rounds\n\n", kWidth, kHeight, kRounds);
+	printf("                   in cache                 whole screen\n");
+	printf("scale    scalar   %8s  speedup    scalar   %8s  speedup\n",
+		   expand_span_variant(), expand_span_variant());
+
+	for (int scale = 1; scale <= 4; scale++)
+	{
+		bigtime_t scalar = time_screen(expand_span_scalar, src, dst, scale,
+									   false);
+		bigtime_t vector = time_screen(expand_span, src, dst, scale, false);
+		bigtime_t scalar_screen = time_screen(expand_span_scalar, src, dst,
+											  scale, true);
+		bigtime_t vector_screen = time_screen(expand_span, src, dst, scale,
+											  true);
+		printf("%5d  %6" B_PRIdBIGTIME " us  %6" B_PRIdBIGTIME " us  %6.1fx"
+			   "  %6" B_PRIdBIGTIME " us  %6" B_PRIdBIGTIME " us  %6.1fx\n",
+			   scale, scalar, vector, (double) scalar / vector,
+			   scalar_screen, vector_screen,
+			   (double) scalar_screen / vector_screen);
+	}
+
+	printf("\nmemset() of the screen: %" B_PRIdBIGTIME " us\n",
+		   time_memset(dst));
+
+	free(src);
+	free(dst);
+	free(check);
+	return 0;
+}
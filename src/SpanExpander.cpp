@@ -0,0 +1,309 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Expands rows of a 1 bit per pixel image, most significant bit leftmost,
+ * into B_RGB32 pixels of two colours, optionally scaled horizontally by
+ * an integer factor.  Uses SSE2, AVX2 or NEON where the compiler and the
+ * CPU support them, and a plain loop everywhere else.
+ */
+
+#include "SpanExpander.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#	define SPAN_EXPANDER_X86 1
+#	include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	define SPAN_EXPANDER_NEON 1
+#	include <arm_neon.h>
+#endif
+
+typedef void (*expand_func)(uint32 *dst, const uint8 *src, int first,
+							int count, int scale, uint32 fg, uint32 bg);
+
+// Up to this scale, the vector kernels test every output pixel against
+// the bit it comes from; beyond it a bit covers whole vectors anyway and
+// is simply stored as a run.
+enum { kMaxMaskScale = 4 };
+
+struct bit_masks {
+	// lane[s][p]: the source bit of output pixel p at scale s
+	uint32 lane[kMaxMaskScale + 1][8 * kMaxMaskScale];
+};
+
+static constexpr bit_masks make_bit_masks()
+{
+	bit_masks masks = {};
+	for (int scale = 1; scale <= kMaxMaskScale; scale++)
+		for (int pixel = 0; pixel < 8 * scale; pixel++)
+			masks.lane[scale][pixel] = 0x80 >> (pixel / scale);
+	return masks;
+}
+
+static constexpr bit_masks kBitMasks = make_bit_masks();
+
+void expand_span_scalar(uint32 *dst, const uint8 *src, int first, int count,
+						int scale, uint32 fg, uint32 bg)
+{
+	for (int i = 0; i < count; i++)
+	{
+		int bit = (first + i) / scale;
+		dst[i] = (src[bit / 8] & (0x80 >> (bit & 7))) ? fg : bg;
+	}
+}
+
+// Splits a span into an unaligned head, whole source bytes for the
+// kernel (each covering 8 * scale pixels), and a tail; the head and tail
+// go through the scalar loop.  The kernel is instantiated for each scale
+// up to kMaxMaskScale, so its inner loops are fully unrolled; larger
+// scales use Expand<0>(), which stores runs.
+template<typename Kernel>
+static inline void expand_bytes(uint32 *dst, const uint8 *src, int first,
+								int count, int scale, uint32 fg, uint32 bg)
+{
+	int block = 8 * scale;
+
+	int head = (block - first % block) % block;
+	if (head > count)
+		head = count;
+	expand_span_scalar(dst, src, first, head, scale, fg, bg);
+	dst += head;
+	first += head;
+	count -= head;
+
+	const uint8 *byte = src + first / block;
+	int blocks = count / block;
+	Kernel kernel(scale, fg, bg);
+
+	switch (scale)
+	{
+		case 1:
+			kernel.template Expand<1>(dst, byte, blocks);
+			break;
+		case 2:
+			kernel.template Expand<2>(dst, byte, blocks);
+			break;
+		case 3:
+			kernel.template Expand<3>(dst, byte, blocks);
+			break;
+		case 4:
+			kernel.template Expand<4>(dst, byte, blocks);
+			break;
+		default:
+			kernel.template Expand<0>(dst, byte, blocks);
+			break;
+	}
+
+	dst += blocks * block;
+	first += blocks * block;
+	count -= blocks * block;
+	expand_span_scalar(dst, src, first, count, scale, fg, bg);
+}
+
+#if SPAN_EXPANDER_X86 && defined(__SSE2__)
+
+struct sse2_kernel {
+	sse2_kernel(int scale, uint32 fg, uint32 bg)
+		:
+		scale(scale),
+		fg(_mm_set1_epi32(fg)),
+		bg(_mm_set1_epi32(bg))
+	{
+	}
+
+	template<int Scale>
+	void Expand(uint32 *dst, const uint8 *src, int blocks) const
+	{
+		for (; blocks > 0; blocks--, src++)
+		{
+			if (Scale == 0)
+			{
+				for (int bit = 0; bit < 8; bit++, dst += scale)
+				{
+					__m128i color = (*src & (0x80 >> bit)) ? fg : bg;
+					int i = 0;
+					for (; i + 4 <= scale; i += 4)
+						_mm_storeu_si128((__m128i *) (dst + i), color);
+					for (; i < scale; i++)
+						dst[i] = _mm_cvtsi128_si32(color);
+				}
+				continue;
+			}
+
+			__m128i bits = _mm_set1_epi32(*src);
+			const uint32 *mask = kBitMasks.lane[Scale];
+			for (int i = 0; i < 8 * Scale; i += 4, dst += 4)
+			{
+				__m128i clear = _mm_cmpeq_epi32(_mm_and_si128(bits,
+					_mm_loadu_si128((const __m128i *) (mask + i))),
+					_mm_setzero_si128());
+				_mm_storeu_si128((__m128i *) dst,
+					_mm_or_si128(_mm_and_si128(clear, bg),
+								 _mm_andnot_si128(clear, fg)));
+			}
+		}
+	}
+
+	int scale;
+	__m128i fg, bg;
+};
+
+static void expand_span_sse2(uint32 *dst, const uint8 *src, int first,
+							 int count, int scale, uint32 fg, uint32 bg)
+{
+	expand_bytes<sse2_kernel>(dst, src, first, count, scale, fg, bg);
+}
+
+#endif // SSE2
+
+#if SPAN_EXPANDER_X86
+
+// Only this kernel is compiled for AVX2, it is picked at run time.  The
+// colours are kept as plain pixels so that no AVX2 type crosses into code
+// compiled without it.
+struct avx2_kernel {
+	avx2_kernel(int scale, uint32 fg, uint32 bg)
+		:
+		scale(scale),
+		fg(fg),
+		bg(bg)
+	{
+	}
+
+	template<int Scale>
+	__attribute__((target("avx2")))
+	void Expand(uint32 *dst, const uint8 *src, int blocks) const
+	{
+		__m256i fg8 = _mm256_set1_epi32(fg);
+		__m256i bg8 = _mm256_set1_epi32(bg);
+
+		for (; blocks > 0; blocks--, src++)
+		{
+			if (Scale == 0)
+			{
+				for (int bit = 0; bit < 8; bit++, dst += scale)
+				{
+					bool set = *src & (0x80 >> bit);
+					__m256i color = set ? fg8 : bg8;
+					int i = 0;
+					for (; i + 8 <= scale; i += 8)
+						_mm256_storeu_si256((__m256i *) (dst + i), color);
+					for (; i < scale; i++)
+						dst[i] = set ? fg : bg;
+				}
+				continue;
+			}
+
+			// 8 * Scale pixels, one vector per step of the scale
+			__m256i bits = _mm256_set1_epi32(*src);
+			const uint32 *mask = kBitMasks.lane[Scale];
+			for (int i = 0; i < 8 * Scale; i += 8, dst += 8)
+			{
+				__m256i clear = _mm256_cmpeq_epi32(_mm256_and_si256(bits,
+					_mm256_loadu_si256((const __m256i *) (mask + i))),
+					_mm256_setzero_si256());
+				_mm256_storeu_si256((__m256i *) dst,
+					_mm256_blendv_epi8(fg8, bg8, clear));
+			}
+		}
+	}
+
+	int scale;
+	uint32 fg, bg;
+};
+
+static void expand_span_avx2(uint32 *dst, const uint8 *src, int first,
+							 int count, int scale, uint32 fg, uint32 bg)
+{
+	expand_bytes<avx2_kernel>(dst, src, first, count, scale, fg, bg);
+}
+
+#endif // SPAN_EXPANDER_X86
+
+#if SPAN_EXPANDER_NEON
+
+struct neon_kernel {
+	neon_kernel(int scale, uint32 fg, uint32 bg)
+		:
+		scale(scale),
+		fg(vdupq_n_u32(fg)),
+		bg(vdupq_n_u32(bg))
+	{
+	}
+
+	template<int Scale>
+	void Expand(uint32 *dst, const uint8 *src, int blocks) const
+	{
+		for (; blocks > 0; blocks--, src++)
+		{
+			if (Scale == 0)
+			{
+				for (int bit = 0; bit < 8; bit++, dst += scale)
+				{
+					uint32x4_t color = (*src & (0x80 >> bit)) ? fg : bg;
+					int i = 0;
+					for (; i + 4 <= scale; i += 4)
+						vst1q_u32(dst + i, color);
+					for (; i < scale; i++)
+						dst[i] = vgetq_lane_u32(color, 0);
+				}
+				continue;
+			}
+
+			uint32x4_t bits = vdupq_n_u32(*src);
+			const uint32 *mask = kBitMasks.lane[Scale];
+			for (int i = 0; i < 8 * Scale; i += 4, dst += 4)
+			{
+				uint32x4_t set = vtstq_u32(bits, vld1q_u32(mask + i));
+				vst1q_u32(dst, vbslq_u32(set, fg, bg));
+			}
+		}
+	}
+
+	int scale;
+	uint32x4_t fg, bg;
+};
+
+static void expand_span_neon(uint32 *dst, const uint8 *src, int first,
+							 int count, int scale, uint32 fg, uint32 bg)
+{
+	expand_bytes<neon_kernel>(dst, src, first, count, scale, fg, bg);
+}
+
+#endif // SPAN_EXPANDER_NEON
+
+struct expand_variant {
+	expand_func func;
+	const char *name;
+};
+
+static expand_variant select_variant()
+{
+#if SPAN_EXPANDER_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return { expand_span_avx2, "AVX2" };
+#	ifdef __SSE2__
+	return { expand_span_sse2, "SSE2" };
+#	endif
+#elif SPAN_EXPANDER_NEON
+	return { expand_span_neon, "NEON" };
+#endif
+	return { expand_span_scalar, "scalar" };
+}
+
+static const expand_variant &active_variant()
+{
+	static const expand_variant variant = select_variant();
+	return variant;
+}
+
+void expand_span(uint32 *dst, const uint8 *src, int first, int count,
+				 int scale, uint32 fg, uint32 bg)
+{
+	active_variant().func(dst, src, first, count, scale, fg, bg);
+}
+
+const char *expand_span_variant()
+{
+	return active_variant().name;
+}
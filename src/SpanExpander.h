@@ -0,0 +1,28 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Expands rows of a 1 bit per pixel image, most significant bit leftmost,
+ * into B_RGB32 pixels of two colours, optionally scaled horizontally by
+ * an integer factor.  Uses SSE2, AVX2 or NEON where the compiler and the
+ * CPU support them, and a plain loop everywhere else.
+ */
+
+#ifndef SPAN_EXPANDER_H
+#define SPAN_EXPANDER_H
+
+#include <SupportDefs.h>
+
+// Writes 'count' pixels to 'dst': pixels first .. first + count - 1 of the
+// bit row 'src' stretched 'scale' times.  Set bits become 'fg', clear ones
+// 'bg'; both are B_RGB32 pixels as laid out in memory.
+void expand_span(uint32 *dst, const uint8 *src, int first, int count,
+				 int scale, uint32 fg, uint32 bg);
+
+// the reference loop, on every machine
+void expand_span_scalar(uint32 *dst, const uint8 *src, int first, int count,
+						int scale, uint32 fg, uint32 bg);
+
+// the name of the variant expand_span() picked for this machine
+const char *expand_span_variant();
+
+#endif // SPAN_EXPANDER_H
@@ -0,0 +1,201 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Benchmark for the text path: draws the Windows NT dump and the MacsBug
+ * call chain at the size the modes use on a 1080p and on a 4K screen,
+ * into an offscreen view, once through DrawString() with a Sync() per
+ * line as draw_string used to, once through DrawString() with one Sync()
+ * per frame, and once composed from a glyph atlas and blitted in one go,
+ * both for be_fixed_font and for the bundled VGA 8x16.  The time to
+ * build each atlas is shown apart, it is paid once per size.
+ *
+ * Needs the app_server.  Build and run with "make TextBench &&
+ * ./TextBench".
+ */
+
+#include <stdio.h>
+
+#include <Application.h>
+#include <Bitmap.h>
+#include <OS.h>
+#include <View.h>
+
+#include "CrashScripts.h"
+#include "FontContext.h"
+#include "GlyphAtlas.h"
+#include "ScriptGlyphs.h"
+
+#include "vga_8x16.h"
+
+static const int kRounds = 20;
+
+enum text_path { kStringSyncPerLine, kStringSyncPerFrame, kAtlas };
+
+static const rgb_color kForeground = { 192, 192, 192, 255 };
+static const rgb_color kBackground = { 0, 0, 128, 255 };
+
+// One frame of 'script' through 'path', the lines as draw_string lays
+// them out; 'scratch' is where the atlas path composes.
+static void draw_script(BView *view, const FontContext &fonts,
+						const crash_script &script, const char *glyphs,
+						BBitmap *scratch, text_path path)
+{
+	int char_width = fonts.CharWidth();
+	int line_height = fonts.LineHeight();
+	int x = 2, y = 2;
+
+	view->SetHighColor(kBackground);
+	view->FillRect(view->Bounds());
+
+	if (path == kAtlas)
+	{
+		GlyphAtlas *atlas = fonts.Atlas();
+		int block_width = script.columns * char_width + 2;
+		int block_height = script.line_count * line_height;
+
+		fill_bitmap_rect(scratch, 0, 0, block_width - 1, block_height - 1,
+						 kBackground);
+		for (int i = 0; i < script.line_count; i++)
+		{
+			const script_line &line = script.lines[i];
+			atlas->Compose(scratch, line.indent * char_width + 1,
+						   i * line_height, glyphs + line.offset, line.length,
+						   kForeground, kBackground);
+		}
+		view->DrawBitmap(scratch, BRect(0, 0, block_width - 1,
+										block_height - 1),
+						 BRect(x - 1, y, x + block_width - 2,
+							   y + block_height - 1));
+		view->Sync();
+		return;
+	}
+
+	view->SetFont(fonts.Font());
+	view->SetHighColor(kForeground);
+	view->SetLowColor(kBackground);
+	for (int i = 0; i < script.line_count; i++, y += line_height)
+	{
+		const script_line &line = script.lines[i];
+		if (line.length > 0)
+			view->DrawString(script.text + line.text_offset, line.text_length,
+							 BPoint(x + line.indent * char_width,
+									y + fonts.Ascent()));
+		if (path == kStringSyncPerLine)
+			view->Sync();
+	}
+	if (path == kStringSyncPerFrame)
+		view->Sync();
+}
+
+static bigtime_t time_script(BView *view, const FontContext &fonts,
+							 const crash_script &script, const char *glyphs,
+							 BBitmap *scratch, text_path path)
+{
+	bigtime_t best = B_INFINITE_TIMEOUT;
+
+	for (int round = 0; round < kRounds; round++)
+	{
+		bigtime_t start = system_time();
+		draw_script(view, fonts, script, glyphs, scratch, path);
+		bigtime_t elapsed = system_time() - start;
+		if (elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+// Times all paths for one script in one font, 'font' NULL for
+// be_fixed_font; the font is 'scale' times the view width.
+static void bench_script(BView *view, const char *name,
+						 const crash_script &script, float scale,
+						 const bitmap_font *font)
+{
+	BRect bounds = view->Bounds();
+	FontContext fonts;
+	if (font)
+		fonts.Validate(bounds, scale, font);
+	else
+		fonts.Validate(bounds, scale, true);
+
+	bigtime_t start = system_time();
+	GlyphAtlas *atlas = font ? new GlyphAtlas(font, fonts.PixelScale())
+		: new GlyphAtlas(fonts.Font());
+	bigtime_t atlas_time = system_time() - start;
+	if (atlas->InitCheck() != B_OK)
+	{
+		printf("%s: no atlas\n", name);
+		delete atlas;
+		return;
+	}
+	fonts.SetAtlas(atlas);
+
+	ScriptGlyphs script_glyphs;
+	const char *glyphs = script_glyphs.Glyphs(script, atlas->Encoding());
+	BBitmap scratch(BRect(0, 0, script.columns * fonts.CharWidth() + 1,
+						  script.line_count * fonts.LineHeight() - 1),
+					B_RGB32);
+	if (!glyphs || scratch.InitCheck() != B_OK)
+	{
+		delete atlas;
+		return;
+	}
+
+	bigtime_t per_line = time_script(view, fonts, script, glyphs, &scratch,
+									 kStringSyncPerLine);
+	bigtime_t per_frame = time_script(view, fonts, script, glyphs, &scratch,
+									  kStringSyncPerFrame);
+	bigtime_t composed = time_script(view, fonts, script, glyphs, &scratch,
+									 kAtlas);
+
+	printf("%-8s %-14s %4dx%-3d %8" B_PRIdBIGTIME " us %8" B_PRIdBIGTIME
+		   " us %8" B_PRIdBIGTIME " us %6.1fx %8" B_PRIdBIGTIME " us\n",
+		   name, font ? font->name : "be_fixed_font", fonts.CharWidth(),
+		   fonts.LineHeight(), per_line, per_frame, composed,
+		   (double) per_line / composed, atlas_time);
+
+	delete atlas;
+}
+
+int main()
+{
+	BApplication app("application/x-vnd.BSOD-TextBench");
+
+	static const struct { int32 width, height; } kScreens[] = {
+		{ 1920, 1080 }, { 3840, 2160 }
+	};
+
+	printf("best of %d rounds; DrawString() with a Sync() per line, with one "
+		   "per frame, and composed from the atlas\n\n", kRounds);
+
+	for (size_t i = 0; i < sizeof(kScreens) / sizeof(kScreens[0]); i++)
+	{
+		BRect bounds(0, 0, kScreens[i].width - 1, kScreens[i].height - 1);
+		BBitmap *frame = new BBitmap(bounds, B_RGB32, true);
+		if (frame->InitCheck() != B_OK)
+		{
+			delete frame;
+			return 1;
+		}
+		BView *view = new BView(bounds, "TextBench", B_FOLLOW_NONE,
+								B_WILL_DRAW);
+		frame->AddChild(view);
+		frame->Lock();
+
+		printf("%" B_PRId32 "x%" B_PRId32 "\n", kScreens[i].width,
+			   kScreens[i].height);
+		printf("script   font           cell      per line   per frame"
+			   "     atlas speedup    build\n");
+
+		// the sizes Windows NT and MacsBug draw at
+		bench_script(view, "wnt", wnt, 0.015625, NULL);
+		bench_script(view, "wnt", wnt, 0.015625, &vga_8x16);
+		bench_script(view, "macsbug", macsbug_body, 0.0125, NULL);
+		printf("\n");
+
+		frame->Unlock();
+		delete frame;
+	}
+
+	return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Text encodings of the crash texts and of the fonts drawing them.  The
+ * texts are written in UTF-8 and decoded once into glyph indices, one
+ * byte per column, in the single byte encoding of the font: code page
+ * 437 for the VGA font, Latin-1 for a BFont.
+ */
+
+#include <string.h>
+
+#include "TextEncoding.h"
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#endif
+
+// the upper halves; all of the encodings agree with ASCII below 0x80
+static const uint16 kCP437High[128] = {
+	0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7,
+	0x00ea, 0x00eb, 0x00e8, 0x00ef, 0x00ee, 0x00ec, 0x00c4, 0x00c5,
+	0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9,
+	0x00ff, 0x00d6, 0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192,
+	0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba,
+	0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+	0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510,
+	0x2514, 0x2534, 0x252c, 0x251c, 0x2500, 0x253c, 0x255e, 0x255f,
+	0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b,
+	0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
+	0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4,
+	0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6, 0x03b5, 0x2229,
+	0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248,
+	0x00b0, 0x2219, 0x00b7, 0x221a, 0x207f, 0x00b2, 0x25a0, 0x00a0,
+};
+
+static const uint16 kMacRomanHigh[128] = {
+	0x00c4, 0x00c5, 0x00c7, 0x00c9, 0x00d1, 0x00d6, 0x00dc, 0x00e1,
+	0x00e0, 0x00e2, 0x00e4, 0x00e3, 0x00e5, 0x00e7, 0x00e9, 0x00e8,
+	0x00ea, 0x00eb, 0x00ed, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3,
+	0x00f2, 0x00f4, 0x00f6, 0x00f5, 0x00fa, 0x00f9, 0x00fb, 0x00fc,
+	0x2020, 0x00b0, 0x00a2, 0x00a3, 0x00a7, 0x2022, 0x00b6, 0x00df,
+	0x00ae, 0x00a9, 0x2122, 0x00b4, 0x00a8, 0x2260, 0x00c6, 0x00d8,
+	0x221e, 0x00b1, 0x2264, 0x2265, 0x00a5, 0x00b5, 0x2202, 0x2211,
+	0x220f, 0x03c0, 0x222b, 0x00aa, 0x00ba, 0x03a9, 0x00e6, 0x00f8,
+	0x00bf, 0x00a1, 0x00ac, 0x221a, 0x0192, 0x2248, 0x2206, 0x00ab,
+	0x00bb, 0x2026, 0x00a0, 0x00c0, 0x00c3, 0x00d5, 0x0152, 0x0153,
+	0x2013, 0x2014, 0x201c, 0x201d, 0x2018, 0x2019, 0x00f7, 0x25ca,
+	0x00ff, 0x0178, 0x2044, 0x20ac, 0x2039, 0x203a, 0xfb01, 0xfb02,
+	0x2021, 0x00b7, 0x201a, 0x201e, 0x2030, 0x00c2, 0x00ca, 0x00c1,
+	0x00cb, 0x00c8, 0x00cd, 0x00ce, 0x00cf, 0x00cc, 0x00d3, 0x00d4,
+	0xf8ff, 0x00d2, 0x00da, 0x00db, 0x00d9, 0x0131, 0x02c6, 0x02dc,
+	0x00af, 0x02d8, 0x02d9, 0x02da, 0x00b8, 0x02dd, 0x02db, 0x02c7,
+};
+
+static const uint16 *high_half(text_encoding encoding)
+{
+	switch (encoding)
+	{
+		case kEncodingCP437:
+			return kCP437High;
+		case kEncodingMacRoman:
+			return kMacRomanHigh;
+		default:
+			return NULL;
+	}
+}
+
+uint32 glyph_to_unicode(text_encoding encoding, uint8 glyph)
+{
+	const uint16 *high = high_half(encoding);
+	if (glyph < 0x80 || !high)
+		return glyph;
+	return high[glyph - 0x80];
+}
+
+uint8 unicode_to_glyph(text_encoding encoding, uint32 code, uint8 fallback)
+{
+	if (code < 0x80)
+		return code;
+
+	const uint16 *high = high_half(encoding);
+	if (!high)
+		return code <= 0xff ? code : fallback;
+
+	// crash texts are mostly ASCII, a linear search is plenty
+	for (int i = 0; i < 128; i++)
+		if (high[i] == code)
+			return 0x80 + i;
+
+	return fallback;
+}
+
+// Returns how many bytes at the start of 'text' are ASCII, 16 or 8 at a
+// time; they decode to themselves in every encoding.
+static int32 ascii_prefix(const char *text, int32 length)
+{
+	int32 i = 0;
+
+#if defined(__SSE2__)
+	for (; i + 16 <= length; i += 16)
+	{
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (text + i));
+		if (_mm_movemask_epi8(chunk) != 0)
+			break;
+	}
+#endif
+
+	for (; i + 8 <= length; i += 8)
+	{
+		uint64 chunk;
+		memcpy(&chunk, text + i, sizeof(chunk));
+		if (chunk & 0x8080808080808080ULL)
+			break;
+	}
+
+	while (i < length && !(text[i] & 0x80))
+		i++;
+
+	return i;
+}
+
+// Decodes the UTF-8 sequence starting at text[i], which is not a
+// continuation byte, and advances 'i' past it.
+static uint32 decode_utf8(const char *text, int32 length, int32 &i)
+{
+	uint8 lead = text[i++];
+	if (lead < 0x80)
+		return lead;
+
+	// the payload bits of the lead byte and the continuation bytes due
+	int32 extra = -1;
+	uint32 code = 0;
+	if ((lead & 0xe0) == 0xc0)
+	{
+		extra = 1;
+		code = lead & 0x1f;
+	}
+	else if ((lead & 0xf0) == 0xe0)
+	{
+		extra = 2;
+		code = lead & 0x0f;
+	}
+	else if ((lead & 0xf8) == 0xf0)
+	{
+		extra = 3;
+		code = lead & 0x07;
+	}
+
+	int32 count = 0;
+	for (; i < length && (text[i] & 0xc0) == 0x80; i++, count++)
+		code = (code << 6) | (text[i] & 0x3f);
+
+	return count == extra ? code : 0xfffd;
+}
+
+int32 decode_text(const char *text, int32 length, text_encoding from,
+				  text_encoding to, char *glyphs)
+{
+	if (from == to)
+	{
+		memcpy(glyphs, text, length);
+		return length;
+	}
+
+	int32 count = 0;
+	int32 i = 0;
+
+	while (i < length)
+	{
+		int32 ascii = ascii_prefix(text + i, length - i);
+		memcpy(glyphs + count, text + i, ascii);
+		count += ascii;
+		i += ascii;
+		if (i == length)
+			break;
+
+		uint32 code;
+		if (from != kEncodingUTF8)
+			code = glyph_to_unicode(from, text[i++]);
+		else if ((text[i] & 0xc0) == 0x80)
+		{
+			// a stray continuation byte does not begin a glyph
+			i++;
+			continue;
+		}
+		else
+			code = decode_utf8(text, length, i);
+
+		glyphs[count++] = unicode_to_glyph(to, code);
+	}
+
+	return count;
+}
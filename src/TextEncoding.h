@@ -0,0 +1,37 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Text encodings of the crash texts and of the fonts drawing them.  The
+ * texts are written in UTF-8 and decoded once into glyph indices, one
+ * byte per column, in the single byte encoding of the font: code page
+ * 437 for the VGA font, Latin-1 for a BFont.
+ */
+
+#ifndef TEXT_ENCODING_H
+#define TEXT_ENCODING_H
+
+#include <SupportDefs.h>
+
+enum text_encoding {
+	kEncodingUTF8,
+	kEncodingLatin1,
+	kEncodingCP437,
+	kEncodingMacRoman
+};
+
+// The Unicode code point of a glyph of a single byte encoding.
+uint32 glyph_to_unicode(text_encoding encoding, uint8 glyph);
+
+// The glyph of a single byte encoding for a code point, or 'fallback' if
+// the encoding has none.
+uint8 unicode_to_glyph(text_encoding encoding, uint32 code,
+					   uint8 fallback = '?');
+
+// Decodes 'length' bytes of 'text' in the encoding 'from' into glyphs of
+// the single byte encoding 'to', and returns how many were written; that
+// is never more than 'length'.  In UTF-8 a glyph starts at every byte that
+// is not a continuation byte, malformed sequences become a '?' each.
+int32 decode_text(const char *text, int32 length, text_encoding from,
+				  text_encoding to, char *glyphs);
+
+#endif // TEXT_ENCODING_H
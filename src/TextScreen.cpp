@@ -0,0 +1,276 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * TextScreen: a character cell framebuffer, like the text mode of the
+ * machines being simulated.  Cells carry a glyph and a foreground and
+ * background palette index; only cells that changed since the last
+ * Flush() are composed and sent to the app_server.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Bitmap.h>
+
+#include "DrawBatch.h"
+#include "GlyphAtlas.h"
+#include "ScriptGlyphs.h"
+#include "TextScreen.h"
+
+TextScreen::TextScreen(ScriptGlyphs *scripts)
+{
+	m_scripts = scripts;
+	m_atlas = NULL;
+	m_columns = m_rows = 0;
+	m_cells = NULL;
+	m_dirty = NULL;
+	m_bitmap = NULL;
+
+	m_dirty_left = m_dirty_top = 0;
+	m_dirty_right = m_dirty_bottom = -1;
+
+	rgb_color black = { 0, 0, 0, 255 };
+	for (int i = 0; i < 16; i++)
+		m_palette[i] = black;
+}
+
+TextScreen::~TextScreen()
+{
+	Unset();
+}
+
+status_t TextScreen::SetTo(GlyphAtlas *atlas, int columns, int rows)
+{
+	if (atlas == m_atlas && columns == m_columns && rows == m_rows && m_cells)
+		return B_OK;
+
+	Unset();
+
+	if (!atlas || columns <= 0 || rows <= 0)
+		return B_BAD_VALUE;
+
+	m_cells = (cell *) malloc(columns * rows * sizeof(cell));
+	m_dirty = (uint32 *) malloc(((columns * rows + 31) / 32) * sizeof(uint32));
+	m_bitmap = new BBitmap(BRect(0, 0, columns * atlas->CharWidth() - 1,
+								 rows * atlas->LineHeight() - 1), B_RGB32);
+
+	if (!m_cells || !m_dirty || m_bitmap->InitCheck() != B_OK)
+	{
+		Unset();
+		return B_NO_MEMORY;
+	}
+
+	m_atlas = atlas;
+	m_columns = columns;
+	m_rows = rows;
+
+	Clear(0, 0);
+	Invalidate();
+	return B_OK;
+}
+
+size_t TextScreen::BytesFor(const GlyphAtlas *atlas, int columns, int rows)
+{
+	if (!atlas || columns <= 0 || rows <= 0)
+		return 0;
+
+	return columns * rows * sizeof(cell)
+		+ ((columns * rows + 31) / 32) * sizeof(uint32)
+		+ (size_t) columns * atlas->CharWidth() * rows * atlas->LineHeight()
+			* sizeof(uint32);
+}
+
+size_t TextScreen::Bytes() const
+{
+	return m_cells ? BytesFor(m_atlas, m_columns, m_rows) : 0;
+}
+
+void TextScreen::Unset()
+{
+	free(m_cells);
+	free(m_dirty);
+	delete m_bitmap;
+
+	m_atlas = NULL;
+	m_columns = m_rows = 0;
+	m_cells = NULL;
+	m_dirty = NULL;
+	m_bitmap = NULL;
+
+	m_dirty_left = m_dirty_top = 0;
+	m_dirty_right = m_dirty_bottom = -1;
+}
+
+int TextScreen::Width() const
+{
+	return m_atlas ? m_columns * m_atlas->CharWidth() : 0;
+}
+
+int TextScreen::Height() const
+{
+	return m_atlas ? m_rows * m_atlas->LineHeight() : 0;
+}
+
+void TextScreen::SetColor(uint8 index, rgb_color color)
+{
+	index &= 15;
+	rgb_color &entry = m_palette[index];
+	if (entry.red == color.red && entry.green == color.green
+		&& entry.blue == color.blue)
+		return;
+
+	entry = color;
+	Invalidate();
+}
+
+void TextScreen::Clear(uint8 fg, uint8 bg)
+{
+	for (int row = 0; row < m_rows; row++)
+		for (int col = 0; col < m_columns; col++)
+			Put(col, row, ' ', fg, bg);
+}
+
+void TextScreen::Put(int col, int row, char glyph, uint8 fg, uint8 bg)
+{
+	if (col < 0 || col >= m_columns || row < 0 || row >= m_rows)
+		return;
+
+	cell &c = m_cells[row * m_columns + col];
+	if (c.glyph == glyph && c.fg == fg && c.bg == bg)
+		return;
+
+	c.glyph = glyph;
+	c.fg = fg;
+	c.bg = bg;
+	mark_dirty(col, row);
+}
+
+void TextScreen::Write(int col, int row, const char *glyphs, int length,
+					   uint8 fg, uint8 bg)
+{
+	for (int i = 0; i < length; i++)
+		Put(col + i, row, glyphs[i], fg, bg);
+}
+
+void TextScreen::WriteBlock(int col, int row, int win_cols, int win_rows,
+							const crash_script &script, uint8 fg, uint8 bg,
+							int max_lines)
+{
+	if (!m_atlas)
+		return;
+
+	const char *glyphs = m_scripts->Glyphs(script, m_atlas->Encoding());
+	if (!glyphs)
+		return;
+
+	int x = (win_cols - script.columns) / 2;
+	int y = (win_rows - script.line_count) / 2;
+
+	if (x < 0) x = 0;
+	if (y < 0) y = 0;
+
+	x += col;
+	y += row;
+
+	int lines = script.line_count;
+	if (max_lines >= 0 && max_lines < lines)
+		lines = max_lines;
+
+	for (int i = 0; i < lines; i++)
+	{
+		const script_line &line = script.lines[i];
+		Write(x + line.indent, y + i, glyphs + line.offset, line.length,
+			  line.inverted ? bg : fg, line.inverted ? fg : bg);
+	}
+}
+
+void TextScreen::Invalidate()
+{
+	if (!m_dirty)
+		return;
+
+	memset(m_dirty, 0xff, ((m_columns * m_rows + 31) / 32) * sizeof(uint32));
+	m_dirty_left = m_dirty_top = 0;
+	m_dirty_right = m_columns - 1;
+	m_dirty_bottom = m_rows - 1;
+}
+
+void TextScreen::mark_dirty(int col, int row)
+{
+	int index = row * m_columns + col;
+	m_dirty[index / 32] |= 1UL << (index & 31);
+
+	if (m_dirty_left > m_dirty_right)
+	{
+		m_dirty_left = m_dirty_right = col;
+		m_dirty_top = m_dirty_bottom = row;
+		return;
+	}
+
+	if (col < m_dirty_left) m_dirty_left = col;
+	if (col > m_dirty_right) m_dirty_right = col;
+	if (row < m_dirty_top) m_dirty_top = row;
+	if (row > m_dirty_bottom) m_dirty_bottom = row;
+}
+
+void TextScreen::Flush(DrawBatch *batch, BPoint origin)
+{
+	if (!IsDirty())
+		return;
+
+	// the cells flushed before in this frame must be drawn first
+	if (batch->References(m_bitmap))
+		batch->Flush();
+
+	int char_width = m_atlas->CharWidth();
+	int line_height = m_atlas->LineHeight();
+	char run[256];
+	int32 runs = 0;
+
+	// compose runs of dirty cells that share their colours
+	for (int row = m_dirty_top; row <= m_dirty_bottom; row++)
+	{
+		int col = m_dirty_left;
+		while (col <= m_dirty_right)
+		{
+			int index = row * m_columns + col;
+			if (!(m_dirty[index / 32] & (1UL << (index & 31))))
+			{
+				col++;
+				continue;
+			}
+
+			const cell &first = m_cells[index];
+			int start = col;
+			int length = 0;
+
+			while (col <= m_dirty_right && length < (int) sizeof(run))
+			{
+				index = row * m_columns + col;
+				const cell &c = m_cells[index];
+				if (!(m_dirty[index / 32] & (1UL << (index & 31)))
+					|| c.fg != first.fg || c.bg != first.bg)
+					break;
+
+				m_dirty[index / 32] &= ~(1UL << (index & 31));
+				run[length++] = c.glyph;
+				col++;
+			}
+
+			m_atlas->Compose(m_bitmap, start * char_width, row * line_height,
+							 run, length, m_palette[first.fg & 15],
+							 m_palette[first.bg & 15]);
+			runs++;
+		}
+	}
+
+	BRect source(m_dirty_left * char_width, m_dirty_top * line_height,
+				 (m_dirty_right + 1) * char_width - 1,
+				 (m_dirty_bottom + 1) * line_height - 1);
+	batch->DrawBitmap(m_bitmap, source,
+					  source.OffsetByCopy(origin.x, origin.y));
+	batch->Fold(runs);
+
+	m_dirty_left = m_dirty_top = 0;
+	m_dirty_right = m_dirty_bottom = -1;
+}
@@ -0,0 +1,88 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * TextScreen: a character cell framebuffer, like the text mode of the
+ * machines being simulated.  Cells carry a glyph and a foreground and
+ * background palette index; only cells that changed since the last
+ * Flush() are composed and sent to the app_server.
+ */
+
+#ifndef TEXT_SCREEN_H
+#define TEXT_SCREEN_H
+
+#include <GraphicsDefs.h>
+#include <Point.h>
+
+#include "ScriptLayout.h"
+
+class BBitmap;
+class DrawBatch;
+class GlyphAtlas;
+class ScriptGlyphs;
+
+class TextScreen {
+ public:
+	// crash scripts are decoded for the atlas through 'scripts'
+	TextScreen(ScriptGlyphs *scripts);
+	~TextScreen();
+
+	// (Re)configures the screen; a no-op if nothing changed, otherwise
+	// all cells are cleared and marked dirty.
+	status_t SetTo(GlyphAtlas *atlas, int columns, int rows);
+	void Unset();
+
+	GlyphAtlas *Atlas() const { return m_atlas; }
+	int Columns() const { return m_columns; }
+	int Rows() const { return m_rows; }
+	int Width() const;
+	int Height() const;
+
+	// the memory it holds, and what SetTo() would allocate for a screen
+	size_t Bytes() const;
+	static size_t BytesFor(const GlyphAtlas *atlas, int columns, int rows);
+
+	void SetColor(uint8 index, rgb_color color);
+
+	void Clear(uint8 fg, uint8 bg);
+	// glyphs are indices in the encoding of the atlas
+	void Put(int col, int row, char glyph, uint8 fg, uint8 bg);
+	void Write(int col, int row, const char *glyphs, int length,
+			   uint8 fg, uint8 bg);
+
+	// Lays out a crash script the way draw_string() does: the block is
+	// centered in win_cols x win_rows cells (or put at the top left if it
+	// does not fit), centered and inverted lines as marked.  At most
+	// max_lines lines are written if max_lines is not negative.
+	void WriteBlock(int col, int row, int win_cols, int win_rows,
+					const crash_script &script, uint8 fg, uint8 bg,
+					int max_lines = -1);
+
+	// marks every cell dirty, e.g. after the view has been invalidated
+	void Invalidate();
+	bool IsDirty() const { return m_dirty_left <= m_dirty_right; }
+
+	// Composes the dirty cells and queues a blit of their bounding
+	// rectangle, with the top left cell at 'origin'.
+	void Flush(DrawBatch *batch, BPoint origin);
+
+ private:
+	struct cell {
+		char glyph;
+		uint8 fg, bg;
+	};
+
+	void mark_dirty(int col, int row);
+
+	ScriptGlyphs *m_scripts;
+	GlyphAtlas *m_atlas;
+	int m_columns, m_rows;
+
+	cell *m_cells;
+	uint32 *m_dirty;	// one bit per cell
+	int m_dirty_left, m_dirty_top, m_dirty_right, m_dirty_bottom;
+
+	rgb_color m_palette[16];
+	BBitmap *m_bitmap;
+};
+
+#endif // TEXT_SCREEN_H
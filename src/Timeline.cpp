@@ -0,0 +1,103 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Timeline: the animation of a crash as a list of keyframes in
+ * milliseconds from its start.  What a mode draws is derived from how
+ * often each key has fallen due by system_time(), not from how many
+ * ticks went by, so a late or dropped tick delays nothing after it, and
+ * the tick can be set to wake up just for the next keyframe.
+ */
+
+#include "Timeline.h"
+
+Timeline::Timeline()
+{
+	m_count = 0;
+	m_start = m_now = 0;
+}
+
+void Timeline::Start(const keyframe *keys, int32 count)
+{
+	m_count = count < kMaxKeys ? count : kMaxKeys;
+	for (int32 i = 0; i < m_count; i++)
+		m_keys[i] = keys[i];
+
+	m_start = m_now = system_time();
+}
+
+void Timeline::Stop()
+{
+	m_count = 0;
+}
+
+void Timeline::SetCount(int32 event, int32 count)
+{
+	for (int32 i = 0; i < m_count; i++)
+	{
+		if (m_keys[i].event == event)
+			m_keys[i].count = count;
+	}
+}
+
+void Timeline::Update()
+{
+	m_now = system_time();
+}
+
+void Timeline::Seek(bigtime_t elapsed)
+{
+	m_now = m_start + elapsed;
+}
+
+void Timeline::Resume()
+{
+	bigtime_t now = system_time();
+	m_start = now - Elapsed();
+	m_now = now;
+}
+
+int32 Timeline::count_of(const keyframe &key) const
+{
+	bigtime_t elapsed = Elapsed();
+	bigtime_t at = (bigtime_t) key.at * 1000;
+	if (elapsed < at || key.count == 0)
+		return 0;
+
+	int32 count = 1;
+	if (key.every > 0)
+		count += (int32) ((elapsed - at) / ((bigtime_t) key.every * 1000));
+
+	return key.count != kRepeatForever && count > key.count
+		? key.count : count;
+}
+
+int32 Timeline::Count(int32 event) const
+{
+	for (int32 i = 0; i < m_count; i++)
+	{
+		if (m_keys[i].event == event)
+			return count_of(m_keys[i]);
+	}
+	return 0;
+}
+
+bigtime_t Timeline::UntilNext() const
+{
+	bigtime_t next = B_INFINITE_TIMEOUT;
+
+	for (int32 i = 0; i < m_count; i++)
+	{
+		const keyframe &key = m_keys[i];
+		int32 done = count_of(key);
+		if ((key.count != kRepeatForever && done >= key.count)
+			|| (key.every == 0 && done > 0))
+			continue;
+
+		bigtime_t due = ((bigtime_t) key.at + (bigtime_t) done * key.every)
+			* 1000 - Elapsed();
+		if (due < next)
+			next = due;
+	}
+
+	return next;
+}
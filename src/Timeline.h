@@ -0,0 +1,62 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * Timeline: the animation of a crash as a list of keyframes in
+ * milliseconds from its start.  What a mode draws is derived from how
+ * often each key has fallen due by system_time(), not from how many
+ * ticks went by, so a late or dropped tick delays nothing after it, and
+ * the tick can be set to wake up just for the next keyframe.
+ */
+
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <OS.h>
+
+// a keyframe count for one that repeats until the crash is over
+const int32 kRepeatForever = -1;
+
+struct keyframe {
+	int32 event;	// what the mode asks for, its own numbering
+	int32 at;		// ms after the start
+	int32 every;	// ms between repeats, 0 for none
+	int32 count;	// how often it falls due in all, or kRepeatForever
+};
+
+class Timeline {
+ public:
+	Timeline();
+
+	// starts the keys over from now; they are copied
+	void Start(const keyframe *keys, int32 count);
+	void Stop();
+	// how often the key for 'event' falls due in all, e.g. a line count
+	void SetCount(int32 event, int32 count);
+
+	// Takes the time every query answers for until the next Update(), so
+	// all of one Draw() sees the same moment.
+	void Update();
+	bigtime_t Elapsed() const { return m_now - m_start; }
+	// Answers for 'elapsed' after the start instead, to draw a crash
+	// ahead of time; Resume() then goes on from there in real time.
+	void Seek(bigtime_t elapsed);
+	void Resume();
+
+	// how often the key for 'event' has fallen due, 0 before its time
+	int32 Count(int32 event) const;
+	bool Passed(int32 event) const { return Count(event) > 0; }
+
+	// until a key falls due next, B_INFINITE_TIMEOUT if none will
+	bigtime_t UntilNext() const;
+
+ private:
+	enum { kMaxKeys = 8 };
+
+	int32 count_of(const keyframe &key) const;
+
+	keyframe m_keys[kMaxKeys];
+	int32 m_count;
+	bigtime_t m_start, m_now;
+};
+
+#endif // TIMELINE_H
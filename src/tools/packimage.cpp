@@ -0,0 +1,365 @@
+/*
+ * BSOD - Blue Screen of Death screensaver
+ *
+ * packimage: converts artwork into the packed_image format of
+ * PackedImage.h, either as a header to compile in or as a binary blob.
+ * Built and run on the build host by the Makefile.
+ *
+ *	packimage [-b] <image> <name> <output>
+ *
+ * Images are PBM (P1/P4), XBM or PGM (P2/P5).  Black and white images are
+ * drawn in B_CMAP8 black (0x00) and white (0x3f); the samples of a PGM
+ * are taken as B_CMAP8 indices themselves.  With -b a blob is written as
+ * described by packed_image_blob in PackedImage.h, otherwise a header
+ * defining <name>_width, <name>_height and the packed_image <name>_image.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+// the B_CMAP8 indices of black and white in the system palette
+static const uint8_t kBlack = 0x00;
+static const uint8_t kWhite = 0x3f;
+
+struct image {
+	int width, height;
+	std::vector<uint8_t> pixels;	// B_CMAP8 indices, width * height
+};
+
+static void fail(const char *message, const char *detail = "")
+{
+	fprintf(stderr, "packimage: %s%s\n", message, detail);
+	exit(1);
+}
+
+static bool read_file(const char *path, std::vector<uint8_t> &data)
+{
+	FILE *file = fopen(path, "rb");
+	if (!file)
+		return false;
+
+	uint8_t buffer[4096];
+	size_t count;
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		data.insert(data.end(), buffer, buffer + count);
+
+	fclose(file);
+	return true;
+}
+
+// netpbm header fields: whitespace and comments in between
+static int pnm_number(const std::vector<uint8_t> &data, size_t &pos)
+{
+	while (pos < data.size())
+	{
+		if (data[pos] == '#')
+		{
+			while (pos < data.size() && data[pos] != '\n')
+				pos++;
+		}
+		else if (isspace(data[pos]))
+			pos++;
+		else
+			break;
+	}
+
+	if (pos >= data.size() || !isdigit(data[pos]))
+		fail("malformed netpbm header");
+
+	int value = 0;
+	while (pos < data.size() && isdigit(data[pos]))
+		value = value * 10 + data[pos++] - '0';
+	return value;
+}
+
+static void read_pnm(const std::vector<uint8_t> &data, image &out)
+{
+	char kind = data[1];
+	size_t pos = 2;
+
+	out.width = pnm_number(data, pos);
+	out.height = pnm_number(data, pos);
+	int maxval = 1;
+	if (kind == '2' || kind == '5')
+	{
+		maxval = pnm_number(data, pos);
+		if (maxval > 255)
+			fail("only 8 bit PGM images are supported");
+	}
+	pos++;	// the single whitespace ending the header
+
+	out.pixels.resize(out.width * out.height);
+	for (int y = 0; y < out.height; y++)
+	{
+		for (int x = 0; x < out.width; x++)
+		{
+			int value;
+			if (kind == '4')
+			{
+				size_t at = pos + y * ((out.width + 7) / 8) + x / 8;
+				if (at >= data.size())
+					fail("truncated PBM image");
+				value = (data[at] >> (7 - x % 8)) & 1;
+			}
+			else if (kind == '5')
+			{
+				size_t at = pos + y * out.width + x;
+				if (at >= data.size())
+					fail("truncated PGM image");
+				value = data[at];
+			}
+			else if (kind == '1')
+			{
+				// plain PBM digits need not be separated
+				while (pos < data.size() && data[pos] != '0' && data[pos] != '1')
+					pos++;
+				if (pos >= data.size())
+					fail("truncated PBM image");
+				value = data[pos++] - '0';
+			}
+			else
+				value = pnm_number(data, pos);
+
+			if (kind == '1' || kind == '4')
+				value = value ? kBlack : kWhite;
+			out.pixels[y * out.width + x] = value;
+		}
+	}
+}
+
+static void read_xbm(const std::vector<uint8_t> &data, image &out)
+{
+	std::string text(data.begin(), data.end());
+
+	size_t width = text.find("_width ");
+	size_t height = text.find("_height ");
+	size_t bits = text.find('{');
+	if (width == std::string::npos || height == std::string::npos
+		|| bits == std::string::npos)
+		fail("malformed XBM image");
+
+	out.width = atoi(text.c_str() + width + 7);
+	out.height = atoi(text.c_str() + height + 8);
+
+	std::vector<uint8_t> bytes;
+	const char *p = text.c_str() + bits + 1;
+	while (*p && *p != '}')
+	{
+		char *end;
+		long value = strtol(p, &end, 0);
+		if (end == p)
+		{
+			p++;
+			continue;
+		}
+		bytes.push_back(value);
+		p = end;
+	}
+
+	// XBM rows are padded to a byte, the first pixel in the lowest bit
+	int row_bytes = (out.width + 7) / 8;
+	if ((int) bytes.size() < row_bytes * out.height)
+		fail("truncated XBM image");
+
+	out.pixels.resize(out.width * out.height);
+	for (int y = 0; y < out.height; y++)
+		for (int x = 0; x < out.width; x++)
+			out.pixels[y * out.width + x]
+				= (bytes[y * row_bytes + x / 8] >> (x % 8)) & 1 ? kBlack : kWhite;
+}
+
+static std::vector<uint8_t> packbits(const std::vector<uint8_t> &in)
+{
+	std::vector<uint8_t> out;
+	size_t i = 0, n = in.size();
+
+	while (i < n)
+	{
+		size_t run = 1;
+		while (i + run < n && in[i + run] == in[i] && run < 128)
+			run++;
+
+		if (run > 1)
+		{
+			out.push_back((uint8_t) (1 - (int) run));
+			out.push_back(in[i]);
+			i += run;
+			continue;
+		}
+
+		// literals up to the next pair of equal bytes
+		size_t count = 0;
+		while (i + count < n && count < 128
+			   && !(i + count + 1 < n && in[i + count + 1] == in[i + count]))
+			count++;
+
+		out.push_back(count - 1);
+		out.insert(out.end(), in.begin() + i, in.begin() + i + count);
+		i += count;
+	}
+
+	return out;
+}
+
+static uint32_t pixel_checksum(const image &in)
+{
+	uint32_t hash = 2166136261U;
+	for (size_t i = 0; i < in.pixels.size(); i++)
+	{
+		hash ^= in.pixels[i];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+struct packed {
+	int depth;
+	std::vector<uint8_t> colors;	// 1 << depth entries
+	bool compressed;
+	std::vector<uint8_t> data;
+	uint32_t checksum;
+};
+
+static void pack(const image &in, packed &out)
+{
+	// the palette, in index order
+	bool used[256] = {};
+	for (size_t i = 0; i < in.pixels.size(); i++)
+		used[in.pixels[i]] = true;
+
+	uint8_t value_of[256] = {};
+	out.colors.clear();
+	for (int c = 0; c < 256; c++)
+	{
+		if (used[c])
+		{
+			value_of[c] = out.colors.size();
+			out.colors.push_back(c);
+		}
+	}
+
+	out.depth = 1;
+	while ((1U << out.depth) < out.colors.size())
+		out.depth *= 2;
+	out.colors.resize(1 << out.depth, 0);
+
+	int row_bytes = (in.width * out.depth + 7) / 8;
+	std::vector<uint8_t> raw(row_bytes * in.height);
+	for (int y = 0; y < in.height; y++)
+	{
+		for (int x = 0; x < in.width; x++)
+		{
+			int bit = x * out.depth;
+			raw[y * row_bytes + bit / 8] |= value_of[in.pixels[y * in.width + x]]
+				<< (8 - out.depth - bit % 8);
+		}
+	}
+
+	std::vector<uint8_t> compressed = packbits(raw);
+	out.compressed = compressed.size() < raw.size();
+	out.data = out.compressed ? compressed : raw;
+	out.checksum = pixel_checksum(in);
+}
+
+static void write_header(FILE *file, const char *name, const image &in,
+						 const packed &out)
+{
+	fprintf(file, "#include \"PackedImage.h\"\n\n");
+	fprintf(file, "const int32 %s_width = %d;\n", name, in.width);
+	fprintf(file, "const int32 %s_height = %d;\n\n", name, in.height);
+
+	fprintf(file, "// %d %s per pixel%s, see PackedImage.h\n", out.depth,
+			out.depth == 1 ? "bit" : "bits",
+			out.compressed ? ", PackBits compressed" : "");
+	fprintf(file, "const unsigned char %s_bits [] = {\n", name);
+	for (size_t i = 0; i < out.data.size(); i++)
+	{
+		fprintf(file, "%s0x%02x,%s", i % 16 == 0 ? "\t" : "", out.data[i],
+				i % 16 == 15 || i + 1 == out.data.size() ? "\n" : "");
+	}
+	fprintf(file, "};\n\n");
+
+	fprintf(file, "const unsigned char %s_colors [] = {\n\t", name);
+	for (size_t i = 0; i < out.colors.size(); i++)
+		fprintf(file, "%s0x%02x", i > 0 ? "," : "", out.colors[i]);
+	fprintf(file, "\n};\n\n");
+
+	fprintf(file, "const packed_image %s_image = {\n", name);
+	fprintf(file, "\t%s_width, %s_height, %d, %s_colors, %s,\n", name, name,
+			out.depth, name, out.compressed ? "true" : "false");
+	fprintf(file, "\t%s_bits, sizeof(%s_bits), 0x%08x\n", name, name,
+			out.checksum);
+	fprintf(file, "};\n");
+}
+
+static void put32(FILE *file, uint32_t value)
+{
+	uint8_t bytes[4] = { (uint8_t) value, (uint8_t) (value >> 8),
+						 (uint8_t) (value >> 16), (uint8_t) (value >> 24) };
+	fwrite(bytes, 1, 4, file);
+}
+
+static void write_blob(FILE *file, const image &in, const packed &out)
+{
+	// packed_image_blob, little endian
+	fwrite("PKIM", 1, 4, file);
+	put32(file, in.width);
+	put32(file, in.height);
+	put32(file, out.depth);
+	put32(file, out.compressed);
+	put32(file, out.data.size());
+	put32(file, out.checksum);
+	fwrite(&out.colors[0], 1, out.colors.size(), file);
+	fwrite(&out.data[0], 1, out.data.size(), file);
+}
+
+int main(int argc, char **argv)
+{
+	bool blob = argc > 1 && strcmp(argv[1], "-b") == 0;
+	if (argc != (blob ? 5 : 4))
+	{
+		fprintf(stderr, "usage: packimage [-b] <image> <name> <output>\n");
+		return 1;
+	}
+
+	const char *path = argv[blob ? 2 : 1];
+	const char *name = argv[blob ? 3 : 2];
+	const char *output = argv[blob ? 4 : 3];
+
+	std::vector<uint8_t> data;
+	if (!read_file(path, data) || data.size() < 2)
+		fail("cannot read ", path);
+
+	image in;
+	if (data[0] == 'P' && strchr("1245", data[1]))
+		read_pnm(data, in);
+	else if (data[0] == '#')
+		read_xbm(data, in);
+	else
+		fail("unknown image format: ", path);
+
+	if (in.width <= 0 || in.height <= 0)
+		fail("empty image: ", path);
+
+	packed out;
+	pack(in, out);
+
+	FILE *file = fopen(output, blob ? "wb" : "w");
+	if (!file)
+		fail("cannot write ", output);
+
+	if (blob)
+		write_blob(file, in, out);
+	else
+		write_header(file, name, in, out);
+
+	if (fclose(file) != 0)
+		fail("cannot write ", output);
+	return 0;
+}